@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+
+#include "Core/header/TimeSystem.hpp"
+
+using std::make_shared;
+using std::shared_ptr;
+
+// nextDay z N obserwatorami dziennymi (pusty callback - mierzy samo rozgłaszanie).
+static void BM_NextDayObservers(benchmark::State &state)
+{
+    const auto observerCount = static_cast<size_t>(state.range(0));
+    unsigned long long calls = 0;
+
+    vector<shared_ptr<TimeDataModel::DayPassedCallback>> observers;
+    for (size_t i = 0; i < observerCount; ++i)
+        observers.push_back(make_shared<TimeDataModel::DayPassedCallback>(
+            [&calls](const TimeDataModel &) { calls++; }));
+
+    auto makeModel = [&]
+    {
+        auto model = std::make_unique<TimeDataModel>();
+        for (auto &observer : observers)
+            model->addDayObserver(observer);
+        return model;
+    };
+
+    auto model = makeModel();
+    for (auto _ : state)
+    {
+        if (model->currentGameDay() == MAX_GAME_DAY)
+        {
+            state.PauseTiming();
+            model = makeModel();
+            state.ResumeTiming();
+        }
+        model->nextDay();
+    }
+
+    benchmark::DoNotOptimize(calls);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NextDayObservers)->Arg(1)->Arg(10)->Arg(100);
+
+// Cała kampania (MAX_GAME_DAY - 1 dni) jednym advanceDays, z jednym obserwatorem zbiorczym.
+static void BM_AdvanceWholeCampaign(benchmark::State &state)
+{
+    unsigned long long days = 0;
+    auto observer = make_shared<TimeDataModel::DaysPassedCallback>(
+        [&days](const TimeDataModel &, unsigned short, unsigned short count) { days += count; });
+
+    for (auto _ : state)
+    {
+        TimeDataModel model;
+        model.addDaysObserver(observer);
+        model.advanceDays(MAX_GAME_DAY - MIN_GAME_DAY);
+    }
+
+    benchmark::DoNotOptimize(days);
+    state.SetItemsProcessed(state.iterations() * (MAX_GAME_DAY - MIN_GAME_DAY));
+}
+BENCHMARK(BM_AdvanceWholeCampaign);
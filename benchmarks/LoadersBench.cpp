@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <filesystem>
+
+#include "SyntheticTechTree.hpp"
+#include "Research/ResearchManager.hpp"
+#include "Resources/ResourceConstraints.hpp"
+#include "Resources/ResourcesManager.hpp"
+#include "Core/header/TimeSystem.hpp"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Świeżo zapisany JSON i cache mogą mieć ten sam znacznik czasu (rozdzielczość
+    // systemu plików), a cache musi być nowszy - cofamy JSON o minutę.
+    void backdate(const fs::path &path)
+    {
+        fs::last_write_time(path, fs::last_write_time(path) - std::chrono::minutes(1));
+    }
+
+    // Syntetyczny technologies.json o N węzłach w katalogu tymczasowym.
+    string syntheticTechnologiesPath(size_t count)
+    {
+        const fs::path path = fs::temp_directory_path() / ("manhattan_bench_technologies_" + std::to_string(count) + ".json");
+        writeSyntheticTechTreeJson(makeSyntheticTechTree(count), path.string());
+        backdate(path);
+        fs::remove(path.string() + ".bin");
+        return path.string();
+    }
+
+    // Kopia data/resource_constraints_normal.json - cache nie trafia do drzewa źródeł.
+    string constraintsPath()
+    {
+        const fs::path path = fs::temp_directory_path() / "manhattan_bench_resource_constraints.json";
+        fs::copy_file(fs::path(MANHATTAN_DATA_DIR) / "resource_constraints_normal.json", path,
+                      fs::copy_options::overwrite_existing);
+        backdate(path);
+        fs::remove(path.string() + ".bin");
+        return path.string();
+    }
+}
+
+static void BM_LoadTechnologiesJson(benchmark::State &state)
+{
+    const string path = syntheticTechnologiesPath(static_cast<size_t>(state.range(0)));
+    TimeDataModel time;
+    ResourceConstraints constraints;
+    ResourcesManager resources(constraints, time);
+
+    for (auto _ : state)
+    {
+        ResearchManager research(time, resources);
+        research.loadFromJson(path);
+        benchmark::DoNotOptimize(research.getAllTechnologies().data());
+    }
+
+    state.SetComplexityN(state.range(0));
+    fs::remove(path);
+}
+BENCHMARK(BM_LoadTechnologiesJson)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+static void BM_LoadTechnologiesCached(benchmark::State &state)
+{
+    const string path = syntheticTechnologiesPath(static_cast<size_t>(state.range(0)));
+    TimeDataModel time;
+    ResourceConstraints constraints;
+    ResourcesManager resources(constraints, time);
+
+    // pierwszy start zapisuje cache
+    ResearchManager(time, resources).loadFromJsonCached(path);
+
+    for (auto _ : state)
+    {
+        ResearchManager research(time, resources);
+        research.loadFromJsonCached(path);
+        benchmark::DoNotOptimize(research.getAllTechnologies().data());
+    }
+
+    state.SetComplexityN(state.range(0));
+    fs::remove(path);
+    fs::remove(path + ".bin");
+}
+BENCHMARK(BM_LoadTechnologiesCached)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+static void BM_LoadConstraintsJson(benchmark::State &state)
+{
+    const string path = constraintsPath();
+
+    for (auto _ : state)
+    {
+        ResourceConstraints constraints;
+        benchmark::DoNotOptimize(constraints.loadFromJson(path));
+    }
+
+    fs::remove(path);
+}
+BENCHMARK(BM_LoadConstraintsJson);
+
+static void BM_LoadConstraintsCached(benchmark::State &state)
+{
+    const string path = constraintsPath();
+    ResourceConstraints().loadFromJsonCached(path);
+
+    for (auto _ : state)
+    {
+        ResourceConstraints constraints;
+        benchmark::DoNotOptimize(constraints.loadFromJsonCached(path));
+    }
+
+    fs::remove(path);
+    fs::remove(path + ".bin");
+}
+BENCHMARK(BM_LoadConstraintsCached);
@@ -0,0 +1,284 @@
+#include <benchmark/benchmark.h>
+
+#include "SyntheticTechTree.hpp"
+#include "Research/ResearchManager.hpp"
+#include "Research/ResearchScheduler.hpp"
+#include "Research/TechTreeLayout.hpp"
+#include "Resources/ResourcesManager.hpp"
+#include "Core/header/TimeSystem.hpp"
+
+namespace
+{
+    // Świat z nieograniczonym (praktycznie) budżetem i personelem dla drzewa N węzłów.
+    struct ResearchBenchWorld
+    {
+        TimeDataModel time;
+        ResourceConstraints constraints;
+        ResourcesManager resources;
+        ResearchManager research;
+
+        explicit ResearchBenchWorld(size_t techCount)
+            : constraints(makeConstraints(techCount)),
+              resources(constraints, time),
+              research(time, resources)
+        {
+            resources.hireScientists(static_cast<unsigned>(techCount));
+        }
+
+        static ResourceConstraints makeConstraints(size_t techCount)
+        {
+            ResourceConstraints constraints;
+            constraints.initial_money = 4000000000u;
+            constraints.scientist_daily_cost = 0;
+            constraints.initial_total_scientists = static_cast<unsigned>(techCount);
+            constraints.maximum_total_scientists = static_cast<unsigned>(techCount);
+            constraints.total_numbers_of_all_personnel = 1000000000;
+            return constraints;
+        }
+    };
+}
+
+// Pełne przeliczenie dostępności: loadTechnologies = kompilacja grafu + updateAvailability.
+static void BM_LoadAndUpdateAvailability(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+
+    for (auto _ : state)
+        world.research.loadTechnologies(techs);
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadAndUpdateAvailability)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// startResearch wszystkich technologii dostępnych na starcie.
+static void BM_StartResearch(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+    unsigned long long started = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        world.research.loadTechnologies(techs);
+        vector<TechId> available;
+        for (const auto &tech : world.research.getAllTechnologies())
+        {
+            if (tech.isAvailable())
+                available.push_back(tech.m_index);
+        }
+        state.ResumeTiming();
+
+        for (TechId id : available)
+            started += world.research.startResearch(id);
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.counters["started"] = benchmark::Counter(static_cast<double>(started), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_StartResearch)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// Całe drzewo: start wszystkiego co dostępne, skok do najbliższego ukończenia,
+// przyrostowe odblokowanie zależnych - aż do końca drzewa.
+static void BM_ResearchWholeTree(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ResearchBenchWorld world(count);
+        world.research.loadTechnologies(techs);
+        state.ResumeTiming();
+
+        while (true)
+        {
+            for (const auto &tech : world.research.getAllTechnologies())
+            {
+                if (tech.isAvailable())
+                    world.research.startResearch(tech.m_index);
+            }
+
+            auto days = world.research.daysUntilNextCompletion();
+            if (!days.has_value() || world.time.currentGameDay() + *days > MAX_GAME_DAY)
+                break;
+            world.time.advanceDays(*days);
+        }
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ResearchWholeTree)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// Analityczne ETA całego drzewa w trybie losowym (jedno przejście DP).
+static void BM_EstimateAllCompletions(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    auto techs = makeSyntheticTechTree(count);
+    for (auto &tech : techs)
+    {
+        tech.m_researchDaysMin = tech.m_researchDays / 2;
+        tech.m_researchDaysMax = tech.m_researchDays * 2;
+        tech.m_failureProbability = 0.2f;
+    }
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(techs);
+    world.research.setOutcomeMode(ResearchOutcomeMode::Randomized);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(world.research.estimateAllCompletions());
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EstimateAllCompletions)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// Przyrostowe odświeżenie ścieżki krytycznej po ukończeniu jednej technologii.
+static void BM_SchedulerIncrementalRefresh(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(techs);
+    ResearchScheduler scheduler(world.time, world.research, world.resources);
+    const TechId last = static_cast<TechId>(count - 1);
+    unsigned long long recomputed = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        world.research.loadTechnologies(techs);
+        scheduler.timing(last);
+        TechId root = INVALID_TECH_ID;
+        for (const auto &tech : world.research.getAllTechnologies())
+        {
+            if (tech.isAvailable())
+            {
+                root = tech.m_index;
+                break;
+            }
+        }
+        world.research.startResearch(root);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(scheduler.timing(last));
+        recomputed += scheduler.lastRecomputedCount();
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.counters["recomputed"] = benchmark::Counter(static_cast<double>(recomputed), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_SchedulerIncrementalRefresh)->RangeMultiplier(10)->Range(10, 10000);
+
+// Pełny plan z limitami personelu dla całego drzewa.
+static void BM_PlanSchedule(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(techs);
+    ResearchScheduler scheduler(world.time, world.research, world.resources);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(scheduler.planSchedule(INVALID_TECH_ID));
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_PlanSchedule)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+/* -------------------------------------------------- */
+
+// Układ warstwowy + siatka - raz po wczytaniu technologii.
+static void BM_TechTreeLayoutBuild(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(techs);
+    TechTreeLayout layout;
+
+    for (auto _ : state)
+    {
+        layout.build(world.research);
+        benchmark::DoNotOptimize(layout.bounds());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TechTreeLayoutBuild)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// Zapytanie jednej klatki: okno 1600x900 na środku drzewa - koszt nie powinien rosnąć z N.
+static void BM_TechTreeViewportQuery(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto techs = makeSyntheticTechTree(count);
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(techs);
+    TechTreeLayout layout;
+    layout.build(world.research);
+
+    const LayoutRect &bounds = layout.bounds();
+    const float centerX = (bounds.m_minX + bounds.m_maxX) * 0.5f;
+    const float centerY = (bounds.m_minY + bounds.m_maxY) * 0.5f;
+    const LayoutRect viewport{centerX - 800.f, centerY - 450.f, centerX + 800.f, centerY + 450.f};
+
+    vector<TechId> nodes;
+    vector<unsigned> edges;
+    for (auto _ : state)
+    {
+        layout.query(viewport, nodes, edges);
+        benchmark::DoNotOptimize(nodes.data());
+        benchmark::DoNotOptimize(edges.data());
+    }
+
+    state.counters["nodes"] = static_cast<double>(nodes.size());
+    state.counters["edges"] = static_cast<double>(edges.size());
+}
+BENCHMARK(BM_TechTreeViewportQuery)->RangeMultiplier(10)->Range(10, 10000);
+
+// Zapytania o stan całego drzewa - uchwyty (porównanie liczb) vs napisy (lookup w tablicy symboli).
+static void BM_StateQueriesByHandle(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(makeSyntheticTechTree(count));
+
+    for (auto _ : state)
+    {
+        unsigned available = 0;
+        for (TechId id = 0; id < count; ++id)
+            available += world.research.isAvailable(id) + world.research.isCompleted(id);
+        benchmark::DoNotOptimize(available);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StateQueriesByHandle)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_StateQueriesByName(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    ResearchBenchWorld world(count);
+    world.research.loadTechnologies(makeSyntheticTechTree(count));
+
+    vector<string> names;
+    for (const auto &tech : world.research.getAllTechnologies())
+        names.push_back(tech.m_id.str());
+
+    for (auto _ : state)
+    {
+        unsigned available = 0;
+        for (const auto &name : names)
+            available += world.research.isAvailable(name) + world.research.isCompleted(name);
+        benchmark::DoNotOptimize(available);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StateQueriesByName)->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+#include "Resources/ResourcesManager.hpp"
+#include "Resources/BudgetForecast.hpp"
+#include "Core/header/TimeSystem.hpp"
+
+namespace
+{
+    ResourceConstraints benchConstraints()
+    {
+        ResourceConstraints constraints;
+        constraints.initial_money = 4000000000u;
+        return constraints;
+    }
+}
+
+// Dzienne rozliczenie zasobów (onDaysPassed z paczką 1 dnia) przez nextDay.
+static void BM_ResourcesDayPassed(benchmark::State &state)
+{
+    ResourceConstraints constraints = benchConstraints();
+    auto time = std::make_unique<TimeDataModel>();
+    auto resources = std::make_unique<ResourcesManager>(constraints, *time);
+
+    for (auto _ : state)
+    {
+        if (time->currentGameDay() == MAX_GAME_DAY)
+        {
+            state.PauseTiming();
+            resources.reset();
+            time = std::make_unique<TimeDataModel>();
+            resources = std::make_unique<ResourcesManager>(constraints, *time);
+            state.ResumeTiming();
+        }
+        time->nextDay();
+    }
+
+    benchmark::DoNotOptimize(resources->getMoney());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ResourcesDayPassed);
+
+// Zatrudnienie + zwolnienie jednej osoby każdej roli.
+static void BM_HireFire(benchmark::State &state)
+{
+    ResourceConstraints constraints = benchConstraints();
+    TimeDataModel time;
+    ResourcesManager resources(constraints, time);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+        {
+            const auto role = static_cast<PersonnelRole>(i);
+            benchmark::DoNotOptimize(resources.hire(role, 1));
+            benchmark::DoNotOptimize(resources.fire(role, 1));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * PERSONNEL_ROLE_COUNT * 2);
+}
+BENCHMARK(BM_HireFire);
+
+// Transakcja kadrowa planera: zatrudnienie we wszystkich rolach + zwolnienie, w całości.
+static void BM_StaffingTransaction(benchmark::State &state)
+{
+    ResourceConstraints constraints = benchConstraints();
+    TimeDataModel time;
+    ResourcesManager resources(constraints, time);
+
+    ResourceTransaction hire;
+    ResourceTransaction fire;
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+    {
+        hire.hire(static_cast<PersonnelRole>(i), 3);
+        fire.fire(static_cast<PersonnelRole>(i), 3);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resources.applyTransaction(hire));
+        benchmark::DoNotOptimize(resources.applyTransaction(fire));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_StaffingTransaction);
+
+// Prognoza 365 dni dla wykresu w ResourcesHUD (co klatkę): podsumowanie + seria.
+static void BM_BudgetForecastSeries(benchmark::State &state)
+{
+    ResourceConstraints constraints;
+    TimeDataModel time;
+    ResourcesManager resources(constraints, time);
+    resources.hireScientists(1000);
+    vector<BudgetLevels> series;
+
+    for (auto _ : state)
+    {
+        BudgetForecast forecast(resources);
+        // kilka trwających badań kończących się w różnych dniach
+        for (unsigned short day = 10; day <= 300; day += 30)
+            forecast.addCostChange(day, -50);
+        benchmark::DoNotOptimize(forecast.project(365));
+        forecast.projectSeries(365, series);
+        benchmark::DoNotOptimize(series.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 365);
+}
+BENCHMARK(BM_BudgetForecastSeries);
@@ -0,0 +1,78 @@
+#pragma once
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "Research/ResearchManager.hpp"
+
+// Proceduralne drzewo technologii: węzeł i ma 0-3 wymagań wśród wcześniejszych węzłów,
+// więc graf zawsze jest DAG-iem. Stały seed - te same liczby w każdym przebiegu.
+inline vector<Technology> makeSyntheticTechTree(size_t count, unsigned seed = 1945)
+{
+    std::mt19937 rng(seed);
+    vector<Technology> techs(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Technology &tech = techs[i];
+        tech.m_id = "tech_" + std::to_string(i);
+        tech.m_name = "Technology " + std::to_string(i);
+        tech.m_description = "Synthetic technology used by benchmarks.";
+        tech.m_type = i % 2 ? TechnologyType::Engineering : TechnologyType::Theory;
+        tech.m_researchDays = static_cast<unsigned short>(1 + rng() % 30);
+        tech.m_moneyCost = 100;
+        tech.m_scientistsRequired = 1;
+
+        if (i == 0)
+            continue;
+
+        const size_t prerequisites = std::min<size_t>(i, rng() % 4);
+        for (size_t p = 0; p < prerequisites; ++p)
+        {
+            const Symbol id = "tech_" + std::to_string(rng() % i);
+            if (std::find(tech.m_prerequisites.begin(), tech.m_prerequisites.end(), id) == tech.m_prerequisites.end())
+                tech.m_prerequisites.push_back(id);
+        }
+    }
+
+    return techs;
+}
+
+// Zapisuje drzewo w formacie data/technologies.json.
+inline void writeSyntheticTechTreeJson(const vector<Technology> &techs, const string &path)
+{
+    nlohmann::json data;
+    auto &list = data["technologies"];
+    list = nlohmann::json::array();
+
+    for (const auto &tech : techs)
+    {
+        vector<string> prerequisites;
+        for (const Symbol &pre : tech.m_prerequisites)
+            prerequisites.push_back(pre.str());
+
+        list.push_back({
+            {"id", tech.m_id.str()},
+            {"name", tech.m_name},
+            {"type", tech.m_type == TechnologyType::Engineering ? "engineering" : "theory"},
+            {"research_days", tech.m_researchDays},
+            {"prerequisites", prerequisites},
+            {"description", tech.m_description},
+            {"money_cost", tech.m_moneyCost},
+            {"dayly_cost", tech.m_daylyCost},
+            {"uranium_required", tech.m_uraniumRequired},
+            {"plutonium_required", tech.m_plutoniumRequired},
+            {"workers_required", tech.m_workersRequired},
+            {"engineers_required", tech.m_engineersRequired},
+            {"scientists_required", tech.m_scientistsRequired},
+            {"army_personnel_required", tech.m_armyPersonnelRequired},
+            {"building_required", nlohmann::json::array()},
+            {"characters_involved", nlohmann::json::array()},
+        });
+    }
+
+    std::ofstream(path) << data.dump(2);
+}
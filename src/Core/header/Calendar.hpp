@@ -0,0 +1,180 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+static const constexpr unsigned short MIN_DATA_DAY = 1;
+static const constexpr unsigned short MAX_DATA_DAY = 31;
+static const constexpr unsigned short MIN_DATA_MONTH = 1;
+static const constexpr unsigned short MAX_DATA_MONTH = 12;
+static const constexpr unsigned short MIN_DATA_YEAR = 1939;
+static const constexpr unsigned short MAX_DATA_YEAR = 1946;
+static const constexpr unsigned short MIN_GAME_DAY = 1;
+static const constexpr unsigned short MAX_GAME_DAY = 1826;
+
+typedef enum class DayOfWeek
+{
+    MONDAY,
+    TUESDAY,
+    WEDNESDAY,
+    THURSDAY,
+    FRIDAY,
+    SATURDAY,
+    SUNDAY
+} DayOfWeek;
+
+// =========================================================
+// Kalendarz liczony w czasie kompilacji
+// =========================================================
+// Indeks kalendarza: 0 = 1 stycznia MIN_DATA_YEAR, kolejne dni bez przerw do
+// 31 grudnia MAX_DATA_YEAR. Dzień gry MIN_GAME_DAY leży pod indeksem 0.
+// Zamiana indeks <-> (dzień, miesiąc, rok, dzień tygodnia) to odczyt z tablicy.
+
+// Reguła gregoriańska (1900 nie jest przestępny, 2000 jest).
+inline auto constexpr isLeapYear(unsigned short a_year) -> bool
+{
+    return (a_year % 4 == 0 && a_year % 100 != 0) || a_year % 400 == 0;
+}
+
+inline auto constexpr daysInMonthOf(unsigned short a_month, unsigned short a_year) -> unsigned short
+{
+    constexpr unsigned short DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (a_month < MIN_DATA_MONTH || a_month > MAX_DATA_MONTH)
+        return 0;
+    return (a_month == 2 && isLeapYear(a_year)) ? 29 : DAYS[a_month - 1];
+}
+
+// Dzień tygodnia dowolnej daty (algorytm Sakamoto) - tylko do budowy i weryfikacji tablicy.
+inline auto constexpr computeDayOfWeek(unsigned short a_day, unsigned short a_month, unsigned short a_year) -> DayOfWeek
+{
+    constexpr int OFFSETS[12] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+    int year = a_month < 3 ? a_year - 1 : a_year;
+    // 0 = niedziela
+    const int sundayBased = (year + year / 4 - year / 100 + year / 400 + OFFSETS[a_month - 1] + a_day) % 7;
+    return static_cast<DayOfWeek>((sundayBased + 6) % 7);
+}
+
+struct CalendarEntry
+{
+    std::uint8_t m_day;
+    std::uint8_t m_month;
+    std::uint16_t m_year;
+    DayOfWeek m_dayOfWeek;
+};
+
+static const constexpr unsigned short CALENDAR_YEAR_COUNT = MAX_DATA_YEAR - MIN_DATA_YEAR + 1;
+
+inline auto constexpr computeCalendarDayCount() -> unsigned short
+{
+    unsigned short count = 0;
+    for (unsigned short year = MIN_DATA_YEAR; year <= MAX_DATA_YEAR; ++year)
+        count += isLeapYear(year) ? 366 : 365;
+    return count;
+}
+
+static const constexpr unsigned short CALENDAR_DAY_COUNT = computeCalendarDayCount();
+
+// Indeks 1. dnia każdego roku; ostatni element = CALENDAR_DAY_COUNT.
+inline auto constexpr buildYearStarts() -> std::array<unsigned short, CALENDAR_YEAR_COUNT + 1>
+{
+    std::array<unsigned short, CALENDAR_YEAR_COUNT + 1> starts{};
+    for (unsigned short i = 0; i < CALENDAR_YEAR_COUNT; ++i)
+        starts[i + 1] = starts[i] + (isLeapYear(MIN_DATA_YEAR + i) ? 366 : 365);
+    return starts;
+}
+
+// Przesunięcie 1. dnia miesiąca od początku roku: [przestępny][miesiąc - 1].
+inline auto constexpr buildMonthStarts() -> std::array<std::array<unsigned short, 13>, 2>
+{
+    std::array<std::array<unsigned short, 13>, 2> starts{};
+    for (unsigned short month = 1; month <= 12; ++month)
+    {
+        starts[0][month] = starts[0][month - 1] + daysInMonthOf(month, 1939);
+        starts[1][month] = starts[1][month - 1] + daysInMonthOf(month, 1944);
+    }
+    return starts;
+}
+
+inline auto constexpr buildCalendarTable() -> std::array<CalendarEntry, CALENDAR_DAY_COUNT>
+{
+    std::array<CalendarEntry, CALENDAR_DAY_COUNT> table{};
+    unsigned short day = 1, month = 1, year = MIN_DATA_YEAR;
+    int dayOfWeek = static_cast<int>(computeDayOfWeek(1, 1, MIN_DATA_YEAR));
+
+    for (unsigned short i = 0; i < CALENDAR_DAY_COUNT; ++i)
+    {
+        table[i] = CalendarEntry{static_cast<std::uint8_t>(day), static_cast<std::uint8_t>(month), year,
+                                 static_cast<DayOfWeek>(dayOfWeek)};
+
+        dayOfWeek = (dayOfWeek + 1) % 7;
+        if (++day > daysInMonthOf(month, year))
+        {
+            day = 1;
+            if (++month > MAX_DATA_MONTH)
+            {
+                month = MIN_DATA_MONTH;
+                ++year;
+            }
+        }
+    }
+    return table;
+}
+
+// inline - jedna definicja tablic w programie zamiast kopii w każdej jednostce kompilacji
+inline constexpr auto CALENDAR_YEAR_STARTS = buildYearStarts();
+inline constexpr auto CALENDAR_MONTH_STARTS = buildMonthStarts();
+inline constexpr auto CALENDAR_TABLE = buildCalendarTable();
+
+// Indeks kalendarza daty; zakłada poprawną datę z zakresu (walidacja po stronie DateModel).
+inline auto constexpr calendarIndexOf(unsigned short a_day, unsigned short a_month, unsigned short a_year) -> unsigned short
+{
+    return CALENDAR_YEAR_STARTS[a_year - MIN_DATA_YEAR] +
+           CALENDAR_MONTH_STARTS[isLeapYear(a_year)][a_month - 1] + a_day - 1;
+}
+
+inline auto constexpr calendarEntry(unsigned short a_index) -> const CalendarEntry &
+{
+    return CALENDAR_TABLE[a_index];
+}
+
+inline auto constexpr gameDayToCalendarIndex(unsigned short a_gameDay) -> unsigned short
+{
+    return a_gameDay - MIN_GAME_DAY;
+}
+
+inline auto constexpr calendarIndexToGameDay(unsigned short a_index) -> unsigned short
+{
+    return a_index + MIN_GAME_DAY;
+}
+
+// ---------------------------------------------------------
+// Weryfikacja tablicy w czasie kompilacji
+// ---------------------------------------------------------
+static_assert(!isLeapYear(1900) && isLeapYear(2000) && isLeapYear(1944) && !isLeapYear(1942));
+static_assert(CALENDAR_DAY_COUNT == 2922);
+static_assert(CALENDAR_YEAR_STARTS[CALENDAR_YEAR_COUNT] == CALENDAR_DAY_COUNT);
+static_assert(MAX_GAME_DAY <= calendarIndexToGameDay(CALENDAR_DAY_COUNT - 1));
+static_assert(CALENDAR_TABLE[0].m_day == 1 && CALENDAR_TABLE[0].m_month == 1 && CALENDAR_TABLE[0].m_year == MIN_DATA_YEAR);
+static_assert(CALENDAR_TABLE[CALENDAR_DAY_COUNT - 1].m_day == 31 && CALENDAR_TABLE[CALENDAR_DAY_COUNT - 1].m_month == 12 &&
+              CALENDAR_TABLE[CALENDAR_DAY_COUNT - 1].m_year == MAX_DATA_YEAR);
+// znane daty
+static_assert(CALENDAR_TABLE[0].m_dayOfWeek == DayOfWeek::SUNDAY);
+static_assert(calendarEntry(calendarIndexOf(1, 9, 1939)).m_dayOfWeek == DayOfWeek::FRIDAY);
+static_assert(calendarEntry(calendarIndexOf(7, 12, 1941)).m_dayOfWeek == DayOfWeek::SUNDAY);
+static_assert(calendarEntry(calendarIndexOf(1, 1, 1942)).m_dayOfWeek == DayOfWeek::THURSDAY);
+static_assert(calendarEntry(calendarIndexOf(29, 2, 1944)).m_day == 29);
+static_assert(calendarEntry(calendarIndexOf(1, 3, 1944)).m_dayOfWeek == DayOfWeek::WEDNESDAY);
+static_assert(calendarEntry(calendarIndexOf(16, 7, 1945)).m_dayOfWeek == DayOfWeek::MONDAY);
+// tablica zgodna z algorytmem i odwracalna
+inline auto constexpr verifyCalendarTable() -> bool
+{
+    for (unsigned short i = 0; i < CALENDAR_DAY_COUNT; ++i)
+    {
+        const auto &entry = CALENDAR_TABLE[i];
+        if (calendarIndexOf(entry.m_day, entry.m_month, entry.m_year) != i)
+            return false;
+        if (computeDayOfWeek(entry.m_day, entry.m_month, entry.m_year) != entry.m_dayOfWeek)
+            return false;
+    }
+    return true;
+}
+static_assert(verifyCalendarTable());
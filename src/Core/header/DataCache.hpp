@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+using std::byte;
+using std::span;
+using std::string;
+using std::vector;
+
+// Wersja binarnego cache danych (technologies.json, resource_constraints_*.json).
+// Zmiana układu w którymkolwiek writeBinary/readBinary => podbić.
+static const constexpr std::uint16_t DATA_CACHE_VERSION = 2;
+
+// Plik tylko do odczytu zmapowany w pamięć (POSIX mmap).
+// Na platformach bez mmap zawartość jest wczytywana do bufora.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const string &a_path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    inline auto isOpen() const -> bool { return m_data != nullptr; }
+    inline auto bytes() const -> span<const byte> { return {m_data, m_size}; }
+
+private:
+    const byte *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    vector<byte> m_fallback;
+};
+
+// Cache leży obok pliku źródłowego: "<a_jsonPath>.bin".
+auto binaryCachePath(const string &a_jsonPath) -> string;
+// Cache istnieje i jest nowszy niż JSON.
+auto isBinaryCacheFresh(const string &a_jsonPath) -> bool;
+// Zapis przez plik tymczasowy + rename, żeby równolegle startujące procesy
+// nigdy nie zobaczyły połowy pliku.
+auto writeBinaryCache(const string &a_jsonPath, span<const byte> a_bytes) -> bool;
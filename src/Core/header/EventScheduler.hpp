@@ -0,0 +1,39 @@
+#pragma once
+#include <functional>
+#include <optional>
+#include <vector>
+#include "TimeSystem.hpp"
+
+using std::function;
+using std::optional;
+using std::vector;
+
+// Planista "horyzontu zdarzeń": liczy najbliższy dzień, w którym dzieje się
+// coś obserwowalnego (ukończenie badania, saldo przechodzi przez zero,
+// morale spada do minimum, początek miesiąca), i przeskakuje do niego
+// przez TimeDataModel::advanceDays. Dni pomiędzy zdarzeniami są liczone
+// w postaci zamkniętej przez zbiorczych obserwatorów, więc stan po skoku
+// jest taki sam jak przy przechodzeniu dzień po dniu.
+class EventHorizonScheduler
+{
+public:
+    // Liczba dni do najbliższego zdarzenia danego systemu (1 = jutro)
+    // albo nullopt, jeśli system nie przewiduje żadnego zdarzenia.
+    using HorizonCallback = function<optional<unsigned short>(const TimeDataModel&)>;
+
+    explicit EventHorizonScheduler(TimeDataModel &a_time);
+    ~EventHorizonScheduler() = default;
+
+    auto addHorizon(HorizonCallback a_callback) -> void;
+
+    // Dni do najbliższego zdarzenia, najwyżej a_maxDays i nie dalej niż MAX_GAME_DAY.
+    // 0 = czas się skończył.
+    auto daysUntilNextEvent(unsigned short a_maxDays = MAX_GAME_DAY) const -> unsigned short;
+    // Przeskakuje do najbliższego zdarzenia (włącznie z dniem zdarzenia).
+    // Zwraca liczbę przesuniętych dni (0 = koniec gry).
+    auto runUntilEvent(unsigned short a_maxDays = MAX_GAME_DAY) -> unsigned short;
+
+private:
+    TimeDataModel &m_time;
+    vector<HorizonCallback> m_horizons;
+};
@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using std::shared_ptr;
+using std::vector;
+using std::weak_ptr;
+
+// Priorytety obserwatorów czasu - mniejszy = wcześniej w tym samym dniu.
+// Zasoby muszą być rozliczone, zanim badania zrobią postęp.
+static const constexpr int OBSERVER_PRIORITY_RESOURCES = 0;
+static const constexpr int OBSERVER_PRIORITY_RESEARCH = 10;
+static const constexpr int OBSERVER_PRIORITY_DEFAULT = 100;
+
+class ObserverRegistryBase
+{
+public:
+    virtual ~ObserverRegistryBase() = default;
+    virtual auto remove(std::uint32_t a_id) -> void = 0;
+};
+
+// Uchwyt subskrypcji (RAII): zniszczenie/reset wypisuje obserwatora.
+// Bezpieczny także, gdy rejestr zniknął wcześniej.
+class ObserverSubscription
+{
+public:
+    ObserverSubscription() = default;
+    ObserverSubscription(weak_ptr<ObserverRegistryBase> a_registry, std::uint32_t a_id)
+        : m_registry(std::move(a_registry)), m_id(a_id) {}
+    ~ObserverSubscription() { reset(); }
+
+    ObserverSubscription(const ObserverSubscription &) = delete;
+    ObserverSubscription &operator=(const ObserverSubscription &) = delete;
+
+    ObserverSubscription(ObserverSubscription &&a_other) noexcept
+        : m_registry(std::move(a_other.m_registry)), m_id(a_other.m_id) {}
+
+    ObserverSubscription &operator=(ObserverSubscription &&a_other) noexcept
+    {
+        if (this != &a_other)
+        {
+            reset();
+            m_registry = std::move(a_other.m_registry);
+            m_id = a_other.m_id;
+        }
+        return *this;
+    }
+
+    auto reset() -> void
+    {
+        if (auto registry = m_registry.lock())
+            registry->remove(m_id);
+        m_registry.reset();
+    }
+
+    inline auto isActive() const -> bool { return !m_registry.expired(); }
+
+private:
+    weak_ptr<ObserverRegistryBase> m_registry;
+    std::uint32_t m_id = 0;
+};
+
+// Obserwatorzy w jednej ciągłej tablicy posortowanej wg (priorytet, kolejność dodania).
+// Rozgłaszanie nie dotyka liczników referencji. Wypisanie tylko oznacza wpis jako
+// nieaktywny - tablica jest kompaktowana paczkami poza rozgłaszaniem, więc obserwator
+// może wypisać siebie (lub innych) i dopisać nowych w trakcie wywołania.
+template <typename Callback>
+class ObserverRegistry : public ObserverRegistryBase
+{
+public:
+    auto add(Callback a_callback, int a_priority = OBSERVER_PRIORITY_DEFAULT) -> std::uint32_t
+    {
+        Entry entry{a_priority, m_nextId++, true, std::move(a_callback)};
+        const std::uint32_t id = entry.m_id;
+        m_activeCount++;
+
+        // w trakcie rozgłaszania tablica nie może się realokować
+        if (m_dispatchDepth > 0)
+            m_pending.push_back(std::move(entry));
+        else
+            insertSorted(std::move(entry));
+
+        return id;
+    }
+
+    auto remove(std::uint32_t a_id) -> void override
+    {
+        for (auto &entry : m_entries)
+        {
+            if (entry.m_id == a_id && entry.m_active)
+            {
+                entry.m_active = false;
+                m_activeCount--;
+                m_inactiveCount++;
+                compactIfNeeded();
+                return;
+            }
+        }
+
+        for (auto it = m_pending.begin(); it != m_pending.end(); ++it)
+        {
+            if (it->m_id == a_id)
+            {
+                m_pending.erase(it);
+                m_activeCount--;
+                return;
+            }
+        }
+    }
+
+    template <typename... Args>
+    auto dispatch(Args &&...a_args) -> void
+    {
+        m_dispatchDepth++;
+
+        // wyjątek z obserwatora nie może zostawić rejestru "w trakcie rozgłaszania" -
+        // nowi obserwatorzy utknęliby w m_pending, a kompaktowanie nie ruszyłoby nigdy
+        try
+        {
+            // rozmiar ustalony na starcie - dopisani w trakcie dostaną dopiero następne zdarzenie
+            const size_t count = m_entries.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (m_entries[i].m_active)
+                    m_entries[i].m_callback(a_args...);
+            }
+        }
+        catch (...)
+        {
+            endDispatch();
+            throw;
+        }
+
+        endDispatch();
+    }
+
+    inline auto empty() const -> bool { return m_activeCount == 0; }
+    inline auto size() const -> size_t { return m_activeCount; }
+    // Następne id (pozwala callbackowi znać własną subskrypcję przed dodaniem).
+    inline auto nextId() const -> std::uint32_t { return m_nextId; }
+
+private:
+    struct Entry
+    {
+        int m_priority;
+        std::uint32_t m_id;
+        bool m_active;
+        Callback m_callback;
+    };
+
+    static auto comesBefore(const Entry &a_left, const Entry &a_right) -> bool
+    {
+        return a_left.m_priority != a_right.m_priority ? a_left.m_priority < a_right.m_priority
+                                                       : a_left.m_id < a_right.m_id;
+    }
+
+    auto insertSorted(Entry &&a_entry) -> void
+    {
+        auto position = std::upper_bound(m_entries.begin(), m_entries.end(), a_entry, comesBefore);
+        m_entries.insert(position, std::move(a_entry));
+    }
+
+    auto endDispatch() -> void
+    {
+        if (--m_dispatchDepth == 0)
+        {
+            mergePending();
+            compactIfNeeded();
+        }
+    }
+
+    auto mergePending() -> void
+    {
+        for (auto &entry : m_pending)
+            insertSorted(std::move(entry));
+        m_pending.clear();
+    }
+
+    // Jedno przejście erase/remove_if zamiast usuwania ze środka przy każdym wypisaniu.
+    auto compactIfNeeded() -> void
+    {
+        if (m_dispatchDepth > 0 || m_inactiveCount == 0)
+            return;
+
+        if (m_inactiveCount < COMPACT_MIN_INACTIVE && m_inactiveCount * 4 < m_entries.size())
+            return;
+
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                       [](const Entry &a_entry) { return !a_entry.m_active; }),
+                        m_entries.end());
+        m_inactiveCount = 0;
+    }
+
+private:
+    static const constexpr size_t COMPACT_MIN_INACTIVE = 16;
+
+    vector<Entry> m_entries;
+    vector<Entry> m_pending;
+    std::uint32_t m_nextId = 1;
+    size_t m_activeCount = 0;
+    size_t m_inactiveCount = 0;
+    unsigned m_dispatchDepth = 0;
+};
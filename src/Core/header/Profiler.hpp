@@ -0,0 +1,91 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using std::array;
+using std::string;
+using std::vector;
+
+// Liczba klatek trzymanych w historii (wykresy w ProfilerHUD).
+static const constexpr size_t PROFILER_HISTORY_FRAMES = 240;
+
+// Jeden pomiar w zapisie do Chrome trace (czasy w ns od startu profilera).
+struct ProfileEvent
+{
+    const char *m_name = nullptr;
+    std::uint64_t m_startNs = 0;
+    std::uint64_t m_durationNs = 0;
+};
+
+// Suma czasu jednej sekcji w kolejnych klatkach (bufor cykliczny, ms).
+struct ProfileSection
+{
+    const char *m_name = nullptr;
+    array<float, PROFILER_HISTORY_FRAMES> m_history{};
+    float m_currentMs = 0.f;
+    unsigned m_calls = 0;
+};
+
+// Pomiar klatek i sekcji w wątku UI. Nazwy sekcji muszą żyć tak długo jak profiler
+// (literały) - trzymane są tylko wskaźniki, bez alokacji w trakcie klatki.
+class FrameProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    FrameProfiler();
+    ~FrameProfiler() = default;
+
+    auto beginFrame() -> void;
+    auto endFrame() -> void;
+    auto record(const char *a_name, Clock::time_point a_start, Clock::time_point a_end) -> void;
+    // Czas zmierzony na innym wątku (np. tick symulacji z widoku stanu) - tylko do
+    // historii sekcji, bez zdarzenia w Chrome trace (brak punktu na osi czasu UI).
+    auto addSample(const char *a_name, float a_ms) -> void;
+
+    inline auto frameHistory() const -> const array<float, PROFILER_HISTORY_FRAMES> & { return m_frameHistory; }
+    inline auto sections() const -> const vector<ProfileSection> & { return m_sections; }
+    // Indeks najstarszej klatki w buforach historii (do rysowania z przesunięciem).
+    inline auto historyOffset() const -> size_t { return m_frameIndex % PROFILER_HISTORY_FRAMES; }
+    inline auto frameCount() const -> std::uint64_t { return m_frameIndex; }
+    auto averageFrameMs() const -> float;
+    auto maxFrameMs() const -> float;
+
+    // Nagrywanie zdarzeń do Chrome trace (chrome://tracing, Perfetto).
+    auto startCapture(unsigned a_frames) -> void;
+    inline auto isCapturing() const -> bool { return m_captureFramesLeft > 0; }
+    inline auto capturedEvents() const -> const vector<ProfileEvent> & { return m_capture; }
+    auto writeChromeTrace(const string &a_path) const -> bool;
+
+private:
+    auto findSection(const char *a_name) -> ProfileSection &;
+    auto sinceStartNs(Clock::time_point a_time) const -> std::uint64_t;
+
+private:
+    Clock::time_point m_start;
+    Clock::time_point m_frameStart;
+    std::uint64_t m_frameIndex = 0;
+    array<float, PROFILER_HISTORY_FRAMES> m_frameHistory{};
+    vector<ProfileSection> m_sections;
+    unsigned m_captureFramesLeft = 0;
+    vector<ProfileEvent> m_capture;
+};
+
+// Mierzy czas od konstrukcji do końca zakresu.
+class ScopedTimer
+{
+public:
+    ScopedTimer(FrameProfiler &a_profiler, const char *a_name);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+    FrameProfiler &m_profiler;
+    const char *m_name;
+    FrameProfiler::Clock::time_point m_start;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// Generator xoshiro256** (Blackman, Vigna) seedowany przez SplitMix64.
+// Spełnia UniformRandomBitGenerator, więc działa z rozkładami z <random>.
+// Cały stan to 4 słowa - do snapshotu zapisywany wprost (SnapshotWriter::write),
+// bez tekstowej serializacji mt19937_64 (~6 KB na generator).
+class Xoshiro256
+{
+public:
+    using result_type = std::uint64_t;
+    using State = std::array<std::uint64_t, 4>;
+
+    explicit Xoshiro256(std::uint64_t a_seed = 0) { seed(a_seed); }
+
+    auto seed(std::uint64_t a_seed) -> void
+    {
+        // SplitMix64 rozprowadza dowolny seed (także 0) na niezerowy stan
+        for (auto &word : m_state)
+        {
+            a_seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = a_seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    auto operator()() -> result_type
+    {
+        const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const std::uint64_t t = m_state[1] << 17;
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+
+        return result;
+    }
+
+    static constexpr auto min() -> result_type { return 0; }
+    static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    inline auto state() const -> const State & { return m_state; }
+    // false (bez zmiany) dla stanu zerowego - z niego generator zwraca same zera.
+    auto setState(const State &a_state) -> bool
+    {
+        if (a_state == State{})
+            return false;
+        m_state = a_state;
+        return true;
+    }
+
+    friend bool operator==(const Xoshiro256 &, const Xoshiro256 &) = default;
+
+private:
+    static constexpr auto rotl(std::uint64_t a_value, int a_shift) -> std::uint64_t
+    {
+        return (a_value << a_shift) | (a_value >> (64 - a_shift));
+    }
+
+    State m_state{};
+};
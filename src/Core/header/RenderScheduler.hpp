@@ -0,0 +1,51 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+// Decyduje, kiedy pętla okna ma narysować klatkę, a kiedy może spać w oczekiwaniu
+// na zdarzenie (SDL_WaitEventTimeout). Klatka jest rysowana tylko na żądanie:
+// po wejściu (kilka klatek, żeby ImGui się ustabilizował), po zmianie stanu
+// symulacji albo stale, gdy trwa animacja - i nie częściej niż limit klatek.
+// Czas podawany z zewnątrz, więc logikę da się testować bez zegara.
+class RenderScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static const constexpr unsigned DEFAULT_FRAME_CAP = 60;
+    // ImGui potrzebuje klatki lub dwóch po zdarzeniu (hover, zamknięcie popupu).
+    static const constexpr unsigned INPUT_REDRAW_FRAMES = 2;
+    // Najdłuższe czekanie bez niczego do narysowania - zabezpieczenie przed
+    // przegapionym powiadomieniem, na bezczynności to kilka wybudzeń na sekundę.
+    static const constexpr int IDLE_WAIT_MS = 250;
+
+    explicit RenderScheduler(unsigned a_frameCap = DEFAULT_FRAME_CAP);
+
+    // 0 = bez limitu.
+    auto setFrameCap(unsigned a_fps) -> void;
+    inline auto frameCap() const -> unsigned { return m_frameCap; }
+
+    // Zgłoszenie potrzeby narysowania a_frames kolejnych klatek.
+    auto requestRedraw(unsigned a_frames = 1) -> void;
+    // Animacja (np. kursor tekstowy) - rysowanie w każdym slocie limitu.
+    inline auto setAnimating(bool a_animating) -> void { m_animating = a_animating; }
+    inline auto isAnimating() const -> bool { return m_animating; }
+    inline auto isRedrawPending() const -> bool { return m_pendingFrames > 0 || m_animating; }
+
+    // Czy klatka ma się zacząć teraz (jest żądanie i minął odstęp limitu).
+    auto shouldRender(Clock::time_point a_now) const -> bool;
+    // Ile ms można czekać na zdarzenie przed następną decyzją.
+    auto waitTimeoutMs(Clock::time_point a_now) const -> int;
+    // Początek narysowanej klatki: zużywa jedno żądanie i ustala najbliższy slot.
+    auto beginFrame(Clock::time_point a_now) -> void;
+
+    inline auto renderedFrames() const -> std::uint64_t { return m_renderedFrames; }
+
+private:
+    unsigned m_frameCap = DEFAULT_FRAME_CAP;
+    Clock::duration m_frameInterval{};
+    Clock::time_point m_nextFrame{};
+    unsigned m_pendingFrames = 0;
+    bool m_animating = false;
+    std::uint64_t m_renderedFrames = 0;
+};
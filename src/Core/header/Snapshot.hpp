@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using std::byte;
+using std::span;
+using std::string;
+using std::vector;
+
+// Nagłówek każdego snapshotu: "MPSN" + wersja formatu.
+// Zmiana układu pól w którymkolwiek write/readSnapshot => podbić SNAPSHOT_VERSION.
+static const constexpr std::uint32_t SNAPSHOT_MAGIC = 0x4E53504D;
+static const constexpr std::uint16_t SNAPSHOT_VERSION = 3;
+
+// Dopisuje surowe bajty pól (little-endian hosta, bez paddingu - każde pole osobno).
+class SnapshotWriter
+{
+public:
+    SnapshotWriter() = default;
+    // Ponowne użycie bufora poprzedniego snapshotu (bez nowej alokacji).
+    explicit SnapshotWriter(vector<byte> &&a_buffer);
+    ~SnapshotWriter() = default;
+
+    template <typename T>
+    auto write(const T &a_value) -> void
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot fields must be trivially copyable");
+        const auto offset = m_buffer.size();
+        m_buffer.resize(offset + sizeof(T));
+        std::memcpy(m_buffer.data() + offset, &a_value, sizeof(T));
+    }
+
+    auto writeHeader() -> void;
+    auto writeString(const string &a_value) -> void;
+    inline auto bytes() const -> span<const byte> { return m_buffer; }
+    inline auto release() -> vector<byte> { return std::move(m_buffer); }
+
+private:
+    vector<byte> m_buffer;
+};
+
+// Czyta pola bezpośrednio z cudzego bufora (bez kopiowania całości).
+// Każdy read zwraca false przy końcu danych - nic nie jest wtedy zapisywane do a_value.
+class SnapshotReader
+{
+public:
+    explicit SnapshotReader(span<const byte> a_bytes);
+    ~SnapshotReader() = default;
+
+    template <typename T>
+    auto read(T &a_value) -> bool
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot fields must be trivially copyable");
+        if (m_bytes.size() - m_offset < sizeof(T))
+            return false;
+        std::memcpy(&a_value, m_bytes.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    // Sprawdza magic i wersję.
+    auto readHeader() -> bool;
+    auto readString(string &a_value) -> bool;
+    inline auto atEnd() const -> bool { return m_offset == m_bytes.size(); }
+    inline auto remaining() const -> size_t { return m_bytes.size() - m_offset; }
+
+private:
+    span<const byte> m_bytes;
+    size_t m_offset = 0;
+};
+
+auto saveSnapshotFile(const string &a_path, span<const byte> a_bytes) -> bool;
+auto loadSnapshotFile(const string &a_path, vector<byte> &a_bytes) -> bool;
@@ -0,0 +1,72 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Ograniczona kolejka jeden producent - jeden konsument, bez blokad.
+//
+// Producent pisze tylko m_tail, konsument tylko m_head (osobne linie cache).
+// Każda strona trzyma kopię indeksu drugiej i odświeża ją dopiero, gdy kolejka
+// wygląda na pełną/pustą - w typowym przypadku push/pop nie dotyka cudzej linii.
+// Pojemność musi być potęgą dwójki; T kopiowane przez wartość (małe struktury).
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() = default;
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    // --- wątek producenta ---
+    // false, gdy kolejka jest pełna (element nie został dodany).
+    auto tryPush(const T &a_item) -> bool
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == Capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity)
+                return false;
+        }
+
+        m_items[tail & MASK] = a_item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // --- wątek konsumenta ---
+    auto tryPop(T &a_item) -> bool
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+                return false;
+        }
+
+        a_item = m_items[head & MASK];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Przybliżone (druga strona może właśnie zmieniać kolejkę).
+    inline auto sizeApprox() const -> size_t
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+    static constexpr auto capacity() -> size_t { return Capacity; }
+
+private:
+    static const constexpr size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> m_items{};
+    // indeksy rosną bez końca, pozycja = indeks & MASK
+    alignas(64) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail = 0; // konsument
+    alignas(64) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead = 0; // producent
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Globalna tablica internowanych napisów (id technologii, budynków, postaci).
+// Napis dostaje 32-bitowy uchwyt raz, przy wczytywaniu danych; ten sam napis
+// zawsze daje ten sam uchwyt do końca procesu (uchwyty nie trafiają do zapisów -
+// zapisuje się napisy, bo numeracja zależy od kolejności wczytywania).
+// Wpisy nie są nigdy usuwane, więc referencje zwracane przez name() są stałe.
+// name() i size() nie biorą blokady (światy w sweepie czytają id równolegle) -
+// napisy leżą w kawałkach o stałych adresach, a liczba wpisów jest publikowana atomowo.
+class SymbolTable
+{
+public:
+    static const constexpr std::uint32_t INVALID_SYMBOL = ~std::uint32_t(0);
+    static const constexpr size_t CHUNK_SIZE = 1024;
+    static const constexpr size_t MAX_CHUNKS = 4096;
+
+    static auto global() -> SymbolTable &;
+
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+
+    // Uchwyt napisu; dopisuje go, jeśli jeszcze go nie ma.
+    // Rzuca length_error po przekroczeniu CHUNK_SIZE * MAX_CHUNKS symboli.
+    auto intern(std::string_view a_name) -> std::uint32_t;
+    // Uchwyt istniejącego napisu - bez dopisywania (zapytania ze skryptów, debug).
+    auto find(std::string_view a_name) const -> std::optional<std::uint32_t>;
+    auto name(std::uint32_t a_symbol) const -> const std::string &;
+    auto size() const -> size_t;
+
+private:
+    // chroni m_index i dopisywanie; odczyt napisów po uchwycie go nie potrzebuje
+    mutable std::shared_mutex m_mutex;
+    // kawałki nie są przenoszone ani zwalniane - klucze m_index i referencje z name() są stałe
+    std::array<std::unique_ptr<std::string[]>, MAX_CHUNKS> m_chunks;
+    // wpisy [0, m_size) są kompletne (store-release po zapisie napisu)
+    std::atomic<std::uint32_t> m_size{0};
+    std::unordered_map<std::string_view, std::uint32_t> m_index;
+};
+
+// Uchwyt do napisu w SymbolTable::global(). Porównanie i hash to operacje na liczbie.
+class Symbol
+{
+public:
+    Symbol() = default;
+    // Niejawne - dane można dalej wypełniać napisami (JSON, testy); internuje napis.
+    Symbol(std::string_view a_name) : m_value(SymbolTable::global().intern(a_name)) {}
+    Symbol(const std::string &a_name) : Symbol(std::string_view(a_name)) {}
+    Symbol(const char *a_name) : Symbol(std::string_view(a_name)) {}
+
+    // Symbol istniejącego napisu; nullopt, gdy napisu nigdy nie internowano.
+    static auto find(std::string_view a_name) -> std::optional<Symbol>;
+
+    inline auto value() const -> std::uint32_t { return m_value; }
+    inline auto isValid() const -> bool { return m_value != SymbolTable::INVALID_SYMBOL; }
+    // Pusty napis dla nieprawidłowego symbolu.
+    auto str() const -> const std::string &;
+
+    friend bool operator==(const Symbol &, const Symbol &) = default;
+    // Porównania z napisem - po treści, bez internowania (osobne przeciążenia,
+    // żeby nie konkurowały z niejawną konwersją napisu na Symbol).
+    friend bool operator==(const Symbol &a_symbol, std::string_view a_name) { return a_symbol.str() == a_name; }
+    friend bool operator==(const Symbol &a_symbol, const std::string &a_name) { return a_symbol.str() == a_name; }
+    friend bool operator==(const Symbol &a_symbol, const char *a_name) { return a_symbol.str() == a_name; }
+
+private:
+    std::uint32_t m_value = SymbolTable::INVALID_SYMBOL;
+};
+
+auto operator<<(std::ostream &a_stream, const Symbol &a_symbol) -> std::ostream &;
+
+template <>
+struct std::hash<Symbol>
+{
+    auto operator()(const Symbol &a_symbol) const noexcept -> size_t { return a_symbol.value(); }
+};
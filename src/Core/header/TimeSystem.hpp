@@ -2,31 +2,17 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include "Calendar.hpp"
+#include "ObserverRegistry.hpp"
+
+class SnapshotWriter;
+class SnapshotReader;
 
 using std::function;
+using std::shared_ptr;
 using std::vector;
 using std::weak_ptr;
 
-static const constexpr unsigned short MIN_DATA_DAY = 1;
-static const constexpr unsigned short MAX_DATA_DAY = 31;
-static const constexpr unsigned short MIN_DATA_MONTH = 1;
-static const constexpr unsigned short MAX_DATA_MONTH = 12;
-static const constexpr unsigned short MIN_DATA_YEAR = 1939;
-static const constexpr unsigned short MAX_DATA_YEAR = 1946;
-static const constexpr unsigned short MIN_GAME_DAY = 1;
-static const constexpr unsigned short MAX_GAME_DAY = 1826;
-
-typedef enum class DayOfWeek
-{
-    MONDAY,
-    TUESDAY,
-    WEDNESDAY,
-    THURSDAY,
-    FRIDAY,
-    SATURDAY,
-    SUNDAY
-} DayOfWeek;
-
 class DateModel
 {
 public:
@@ -42,9 +28,15 @@ public:
     auto year(unsigned short a_year) -> void;
     auto operator<=>(const DateModel &other)const  -> void = default;
 
-    inline auto constexpr isLeap(unsigned short year) -> bool
-    { return (year % 4 == 0);}
-    auto constexpr daysInMonth(unsigned short month, unsigned short year) -> unsigned short;
+    inline auto constexpr isLeap(unsigned short year) const -> bool
+    { return isLeapYear(year); }
+    inline auto constexpr daysInMonth(unsigned short month, unsigned short year) const -> unsigned short
+    { return daysInMonthOf(month, year); }
+    // Pozycja w CALENDAR_TABLE i odwrotnie - O(1), bez iterowania po dniach.
+    inline auto calendarIndex() const -> unsigned short { return calendarIndexOf(m_day, m_month, m_year); }
+    static auto fromCalendarIndex(unsigned short a_index) -> DateModel;
+    // Ile dni zostało do 1. dnia następnego miesiąca (1 = jutro).
+    auto daysUntilNextMonth() const -> unsigned short;
     auto nextDay() -> void;
 
 private:
@@ -57,24 +49,65 @@ class TimeDataModel
 {
 public:
     using DayPassedCallback = function<void(const TimeDataModel&)>;
+    // Zbiorczy callback: a_firstDay = pierwszy dzień gry w paczce, a_count = liczba dni.
+    // Wołany raz na paczkę (nextDay -> a_count == 1), po przesunięciu daty na koniec paczki.
+    using DaysPassedCallback = function<void(const TimeDataModel&, unsigned short a_firstDay, unsigned short a_count)>;
+    // Ogranicza długość następnej paczki (zmniejsza a_maxDays, nigdy poniżej 1) do dnia,
+    // po którym zbiorczy obserwator nie umie liczyć w postaci zamkniętej (np. ukończenie badania).
+    using BatchLimitCallback = function<void(const TimeDataModel&, unsigned short &a_maxDays)>;
 
     TimeDataModel();
     ~TimeDataModel() = default;
+    // Kopia przenosi tylko datę - obserwatorzy są związani z oryginałem.
+    // Przypisanie (także z tymczasowego) zachowuje własnych obserwatorów,
+    // więc `t = TimeDataModel();` cofa czas bez gubienia zarejestrowanych managerów.
+    TimeDataModel(const TimeDataModel &a_other);
+    auto operator=(const TimeDataModel &a_other) -> TimeDataModel &;
+    // Przeniesienie zabiera rejestry razem z subskrypcjami.
+    TimeDataModel(TimeDataModel &&) noexcept = default;
 
     inline auto currentDate() const -> const DateModel & { return m_currentDate; }
     inline auto currentGameDay() const -> const unsigned short { return m_currentGameDay; }
     inline auto currentDayOfWeek() const -> const DayOfWeek { return m_currentDayOfWeek; }
+    // Data i dzień tygodnia dowolnego dnia gry (odczyt z CALENDAR_TABLE).
+    // Rzucają range_error poza MIN_GAME_DAY..MAX_GAME_DAY.
+    static auto dateOfGameDay(unsigned short a_gameDay) -> DateModel;
+    static auto dayOfWeekOfGameDay(unsigned short a_gameDay) -> DayOfWeek;
+    static auto gameDayOfDate(const DateModel &a_date) -> unsigned short;
     
     auto nextDay() -> void;
     auto nextTeenDays() -> void;
+    // Przesuwa czas o a_count dni. Obserwatorzy dzienni dostają każdy dzień,
+    // zbiorczy - jedno wywołanie na paczkę; paczki są cięte na limitach
+    // (subscribeBatchLimit), więc wynik jest taki sam jak a_count razy nextDay().
+    // Rzuca range_error (bez zmiany stanu), jeśli przekroczy MAX_GAME_DAY.
+    auto advanceDays(unsigned short a_count) -> void;
+    // Subskrypcja trwa tak długo, jak zwrócony uchwyt. Obserwatorzy są wołani
+    // wg priorytetu (OBSERVER_PRIORITY_*), przy równym - w kolejności dodania.
+    [[nodiscard]] auto subscribeDay(DayPassedCallback a_callback, int a_priority = OBSERVER_PRIORITY_DEFAULT) -> ObserverSubscription;
+    [[nodiscard]] auto subscribeDays(DaysPassedCallback a_callback, int a_priority = OBSERVER_PRIORITY_DEFAULT) -> ObserverSubscription;
+    [[nodiscard]] auto subscribeBatchLimit(BatchLimitCallback a_callback) -> ObserverSubscription;
+    // Starsze API: obserwator żyje, dopóki żyje wskazywany callback
+    // (weak_ptr blokowany przy każdym wywołaniu - w nowym kodzie subscribe*).
     auto addDayObserver(weak_ptr<DayPassedCallback> a_callback) -> void;
+    auto addDaysObserver(weak_ptr<DaysPassedCallback> a_callback) -> void;
+    // Zapis/odczyt daty, dnia gry i dnia tygodnia (obserwatorzy nie są zapisywani).
+    // readSnapshot zwraca false i nie zmienia stanu przy błędnych danych.
+    auto writeSnapshot(SnapshotWriter &a_writer) const -> void;
+    auto readSnapshot(SnapshotReader &a_reader) -> bool;
     
 private:
+    auto stepDate() -> void;
+    // Ustawia datę i dzień tygodnia prosto z tablicy (bez sprawdzania zakresu).
+    auto jumpToGameDay(unsigned short a_gameDay) -> void;
     auto notifyDayObservers() -> void;
+    auto notifyDaysObservers(unsigned short a_firstDay, unsigned short a_count) -> void;
 
 private:
     DateModel m_currentDate;
     unsigned short m_currentGameDay;
     DayOfWeek m_currentDayOfWeek;
-    vector<weak_ptr<DayPassedCallback>> m_dayObservers;
+    shared_ptr<ObserverRegistry<DayPassedCallback>> m_dayObservers;
+    shared_ptr<ObserverRegistry<DaysPassedCallback>> m_daysObservers;
+    shared_ptr<ObserverRegistry<BatchLimitCallback>> m_batchLimits;
 };
@@ -0,0 +1,57 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Potrójny bufor jeden pisarz - jeden czytelnik, bez blokad.
+//
+// Pisarz wypełnia własny bufor (writeBuffer) i publikuje go, zamieniając się
+// atomowo z buforem środkowym. Czytelnik przy read() zabiera środkowy, jeśli jest
+// świeży, i oddaje swój poprzedni. Żadna strona nie czeka na drugą, a czytelnik
+// zawsze widzi kompletny, niezmieniany bufor - do następnego read().
+//
+// Po publish() writeBuffer() wskazuje bufor sprzed dwóch publikacji: pisarz musi
+// nadpisać go w całości (kontenery zachowują pojemność, więc bez alokacji).
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // --- wątek pisarza ---
+    inline auto writeBuffer() -> T & { return m_buffers[m_back]; }
+
+    auto publish() -> void
+    {
+        const std::uint8_t previous = m_middle.exchange(m_back | FRESH_BIT, std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+    }
+
+    // --- wątek czytelnika ---
+    // Najnowszy opublikowany bufor (przed pierwszą publikacją - domyślnie skonstruowany).
+    auto read() -> const T &
+    {
+        if (m_middle.load(std::memory_order_relaxed) & FRESH_BIT)
+        {
+            const std::uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+            m_front = previous & INDEX_MASK;
+        }
+        return m_buffers[m_front];
+    }
+
+    // Czy od ostatniego read() opublikowano coś nowego.
+    inline auto hasFresh() const -> bool { return m_middle.load(std::memory_order_relaxed) & FRESH_BIT; }
+
+private:
+    static const constexpr std::uint8_t FRESH_BIT = 0x4;
+    static const constexpr std::uint8_t INDEX_MASK = 0x3;
+
+    std::array<T, 3> m_buffers{};
+    // Bufory pisarza i czytelnika należą wyłącznie do swoich wątków (osobne linie cache).
+    alignas(64) std::uint8_t m_back = 0;
+    alignas(64) std::uint8_t m_front = 2;
+    alignas(64) std::atomic<std::uint8_t> m_middle{1};
+};
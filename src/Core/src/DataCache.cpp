@@ -0,0 +1,96 @@
+#include "../header/DataCache.hpp"
+#include "../header/Snapshot.hpp"
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <system_error>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+using std::error_code;
+
+MappedFile::MappedFile(const string &a_path)
+{
+#if !defined(_WIN32)
+    const int fd = ::open(a_path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat info{};
+    if (::fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        void *data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            m_data = static_cast<const byte *>(data);
+            m_size = static_cast<size_t>(info.st_size);
+            m_mapped = true;
+        }
+    }
+    ::close(fd);
+#else
+    if (loadSnapshotFile(a_path, m_fallback) && !m_fallback.empty())
+    {
+        m_data = m_fallback.data();
+        m_size = m_fallback.size();
+    }
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if !defined(_WIN32)
+    if (m_mapped)
+        ::munmap(const_cast<byte *>(m_data), m_size);
+#endif
+}
+
+auto binaryCachePath(const string &a_jsonPath) -> string
+{
+    return a_jsonPath + ".bin";
+}
+
+auto isBinaryCacheFresh(const string &a_jsonPath) -> bool
+{
+    error_code jsonError, cacheError;
+    const auto jsonTime = fs::last_write_time(a_jsonPath, jsonError);
+    const auto cacheTime = fs::last_write_time(binaryCachePath(a_jsonPath), cacheError);
+
+    // brak JSON-a przy obecnym cache też jest w porządku (dystrybucja samych blobów)
+    if (cacheError)
+        return false;
+    return jsonError || cacheTime > jsonTime;
+}
+
+auto writeBinaryCache(const string &a_jsonPath, span<const byte> a_bytes) -> bool
+{
+    static std::atomic<unsigned> counter{0};
+
+    const string cachePath = binaryCachePath(a_jsonPath);
+#if !defined(_WIN32)
+    const auto owner = static_cast<unsigned long>(::getpid());
+#else
+    const auto owner = std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+    // unikalny na proces i wywołanie
+    const string tmpPath = cachePath + ".tmp" + std::to_string(owner) + "_" + std::to_string(counter++);
+
+    if (!saveSnapshotFile(tmpPath, a_bytes))
+        return false;
+
+    error_code error;
+    fs::rename(tmpPath, cachePath, error);
+    if (error)
+    {
+        fs::remove(tmpPath, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+#include "../header/EventScheduler.hpp"
+#include <algorithm>
+
+using std::min;
+using std::move;
+
+EventHorizonScheduler::EventHorizonScheduler(TimeDataModel &a_time)
+    : m_time(a_time)
+{
+}
+
+auto EventHorizonScheduler::addHorizon(HorizonCallback a_callback) -> void
+{
+    m_horizons.push_back(move(a_callback));
+}
+
+auto EventHorizonScheduler::daysUntilNextEvent(unsigned short a_maxDays) const -> unsigned short
+{
+    // 1) koniec kampanii
+    unsigned short days = MAX_GAME_DAY - m_time.currentGameDay();
+
+    // 2) limit wywołującego
+    days = min(days, a_maxDays);
+
+    // 3) granica miesiąca (raporty, budżety miesięczne)
+    days = min(days, m_time.currentDate().daysUntilNextMonth());
+
+    // 4) zdarzenia zgłoszone przez systemy gry
+    for (const auto &horizon : m_horizons)
+    {
+        if (auto next = horizon(m_time))
+            days = min(days, std::max<unsigned short>(*next, 1));
+    }
+
+    return days;
+}
+
+auto EventHorizonScheduler::runUntilEvent(unsigned short a_maxDays) -> unsigned short
+{
+    const unsigned short days = daysUntilNextEvent(a_maxDays);
+    if (days > 0)
+        m_time.advanceDays(days);
+    return days;
+}
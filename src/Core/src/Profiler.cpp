@@ -0,0 +1,158 @@
+#include "../header/Profiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using std::cerr;
+using std::ofstream;
+
+namespace
+{
+    auto toMs(FrameProfiler::Clock::duration a_duration) -> float
+    {
+        return std::chrono::duration<float, std::milli>(a_duration).count();
+    }
+
+    // Nazwy sekcji to literały w kodzie, ale na wszelki wypadek escapujemy JSON.
+    auto writeJsonString(ofstream &a_file, const char *a_text) -> void
+    {
+        a_file << '"';
+        for (const char *c = a_text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                a_file << '\\';
+            a_file << *c;
+        }
+        a_file << '"';
+    }
+}
+
+FrameProfiler::FrameProfiler() : m_start(Clock::now()), m_frameStart(m_start) {}
+
+auto FrameProfiler::beginFrame() -> void
+{
+    m_frameStart = Clock::now();
+    for (auto &section : m_sections)
+    {
+        section.m_currentMs = 0.f;
+        section.m_calls = 0;
+    }
+}
+
+auto FrameProfiler::endFrame() -> void
+{
+    const auto frameEnd = Clock::now();
+    const size_t slot = m_frameIndex % PROFILER_HISTORY_FRAMES;
+
+    m_frameHistory[slot] = toMs(frameEnd - m_frameStart);
+    for (auto &section : m_sections)
+        section.m_history[slot] = section.m_currentMs;
+
+    if (m_captureFramesLeft > 0)
+    {
+        m_capture.push_back({"Frame", sinceStartNs(m_frameStart),
+                             static_cast<std::uint64_t>(std::chrono::nanoseconds(frameEnd - m_frameStart).count())});
+        m_captureFramesLeft--;
+    }
+
+    m_frameIndex++;
+}
+
+auto FrameProfiler::record(const char *a_name, Clock::time_point a_start, Clock::time_point a_end) -> void
+{
+    ProfileSection &section = findSection(a_name);
+    section.m_currentMs += toMs(a_end - a_start);
+    section.m_calls++;
+
+    if (m_captureFramesLeft > 0)
+    {
+        m_capture.push_back({a_name, sinceStartNs(a_start),
+                             static_cast<std::uint64_t>(std::chrono::nanoseconds(a_end - a_start).count())});
+    }
+}
+
+auto FrameProfiler::addSample(const char *a_name, float a_ms) -> void
+{
+    ProfileSection &section = findSection(a_name);
+    section.m_currentMs += a_ms;
+    section.m_calls++;
+}
+
+auto FrameProfiler::averageFrameMs() const -> float
+{
+    const size_t frames = std::min<std::uint64_t>(m_frameIndex, PROFILER_HISTORY_FRAMES);
+    if (frames == 0)
+        return 0.f;
+
+    float sum = 0.f;
+    for (size_t i = 0; i < frames; ++i)
+        sum += m_frameHistory[i];
+    return sum / static_cast<float>(frames);
+}
+
+auto FrameProfiler::maxFrameMs() const -> float
+{
+    return *std::max_element(m_frameHistory.begin(), m_frameHistory.end());
+}
+
+auto FrameProfiler::startCapture(unsigned a_frames) -> void
+{
+    m_capture.clear();
+    m_captureFramesLeft = a_frames;
+}
+
+auto FrameProfiler::writeChromeTrace(const string &a_path) const -> bool
+{
+    ofstream file(a_path);
+    if (!file)
+    {
+        cerr << "Cannot open trace file for writing: " << a_path << "\n";
+        return false;
+    }
+
+    // Trace Event Format: zdarzenia "X" (complete), czasy w mikrosekundach
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < m_capture.size(); ++i)
+    {
+        const ProfileEvent &event = m_capture[i];
+        file << (i ? ",\n" : "\n") << "{\"name\":";
+        writeJsonString(file, event.m_name);
+        file << ",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+             << ",\"ts\":" << event.m_startNs / 1000.0
+             << ",\"dur\":" << event.m_durationNs / 1000.0 << "}";
+    }
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
+
+auto FrameProfiler::findSection(const char *a_name) -> ProfileSection &
+{
+    // kilka-kilkanaście sekcji - liniowo, najpierw po wskaźniku
+    for (auto &section : m_sections)
+    {
+        if (section.m_name == a_name || std::strcmp(section.m_name, a_name) == 0)
+            return section;
+    }
+
+    ProfileSection section;
+    section.m_name = a_name;
+    m_sections.push_back(section);
+    return m_sections.back();
+}
+
+auto FrameProfiler::sinceStartNs(Clock::time_point a_time) const -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(std::chrono::nanoseconds(a_time - m_start).count());
+}
+
+ScopedTimer::ScopedTimer(FrameProfiler &a_profiler, const char *a_name)
+    : m_profiler(a_profiler), m_name(a_name), m_start(FrameProfiler::Clock::now())
+{
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    m_profiler.record(m_name, m_start, FrameProfiler::Clock::now());
+}
@@ -0,0 +1,49 @@
+#include "../header/RenderScheduler.hpp"
+#include <algorithm>
+
+RenderScheduler::RenderScheduler(unsigned a_frameCap)
+{
+    setFrameCap(a_frameCap);
+    // pierwsza klatka od razu
+    requestRedraw();
+}
+
+auto RenderScheduler::setFrameCap(unsigned a_fps) -> void
+{
+    m_frameCap = a_fps;
+    m_frameInterval = a_fps == 0
+                          ? Clock::duration::zero()
+                          : std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / a_fps));
+}
+
+auto RenderScheduler::requestRedraw(unsigned a_frames) -> void
+{
+    m_pendingFrames = std::max(m_pendingFrames, a_frames);
+}
+
+auto RenderScheduler::shouldRender(Clock::time_point a_now) const -> bool
+{
+    return isRedrawPending() && a_now >= m_nextFrame;
+}
+
+auto RenderScheduler::waitTimeoutMs(Clock::time_point a_now) const -> int
+{
+    if (!isRedrawPending())
+        return IDLE_WAIT_MS;
+
+    if (a_now >= m_nextFrame)
+        return 0;
+
+    // w górę - czekanie krócej niż do slotu dałoby pusty obieg pętli
+    const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(m_nextFrame - a_now);
+    return static_cast<int>(std::min<std::chrono::milliseconds::rep>(remaining.count(), IDLE_WAIT_MS));
+}
+
+auto RenderScheduler::beginFrame(Clock::time_point a_now) -> void
+{
+    if (m_pendingFrames > 0)
+        m_pendingFrames--;
+
+    m_nextFrame = a_now + m_frameInterval;
+    m_renderedFrames++;
+}
@@ -0,0 +1,79 @@
+#include "../header/Snapshot.hpp"
+#include <fstream>
+#include <iostream>
+
+using std::cerr;
+using std::ifstream;
+using std::ios;
+using std::ofstream;
+
+SnapshotWriter::SnapshotWriter(vector<byte> &&a_buffer) : m_buffer(std::move(a_buffer))
+{
+    m_buffer.clear();
+}
+
+auto SnapshotWriter::writeHeader() -> void
+{
+    write(SNAPSHOT_MAGIC);
+    write(SNAPSHOT_VERSION);
+}
+
+auto SnapshotWriter::writeString(const string &a_value) -> void
+{
+    write(static_cast<std::uint32_t>(a_value.size()));
+    const auto offset = m_buffer.size();
+    m_buffer.resize(offset + a_value.size());
+    std::memcpy(m_buffer.data() + offset, a_value.data(), a_value.size());
+}
+
+SnapshotReader::SnapshotReader(span<const byte> a_bytes) : m_bytes(a_bytes) {}
+
+auto SnapshotReader::readHeader() -> bool
+{
+    std::uint32_t magic = 0;
+    std::uint16_t version = 0;
+    if (!read(magic) || !read(version))
+        return false;
+
+    return magic == SNAPSHOT_MAGIC && version == SNAPSHOT_VERSION;
+}
+
+auto SnapshotReader::readString(string &a_value) -> bool
+{
+    std::uint32_t size = 0;
+    if (!read(size) || m_bytes.size() - m_offset < size)
+        return false;
+
+    a_value.assign(reinterpret_cast<const char *>(m_bytes.data() + m_offset), size);
+    m_offset += size;
+    return true;
+}
+
+auto saveSnapshotFile(const string &a_path, span<const byte> a_bytes) -> bool
+{
+    ofstream file(a_path, ios::binary | ios::trunc);
+    if (!file)
+    {
+        cerr << "Cannot open snapshot file for writing: " << a_path << "\n";
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char *>(a_bytes.data()), static_cast<std::streamsize>(a_bytes.size()));
+    return static_cast<bool>(file);
+}
+
+auto loadSnapshotFile(const string &a_path, vector<byte> &a_bytes) -> bool
+{
+    ifstream file(a_path, ios::binary | ios::ate);
+    if (!file)
+    {
+        cerr << "Cannot open snapshot file: " << a_path << "\n";
+        return false;
+    }
+
+    const auto size = file.tellg();
+    file.seekg(0);
+    a_bytes.resize(static_cast<size_t>(size));
+    file.read(reinterpret_cast<char *>(a_bytes.data()), size);
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,84 @@
+#include "../header/Symbol.hpp"
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+auto SymbolTable::global() -> SymbolTable &
+{
+    static SymbolTable table;
+    return table;
+}
+
+auto SymbolTable::intern(std::string_view a_name) -> std::uint32_t
+{
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_index.find(a_name);
+        if (it != m_index.end())
+            return it->second;
+    }
+
+    std::unique_lock lock(m_mutex);
+    // mógł go dopisać inny wątek między blokadami
+    auto it = m_index.find(a_name);
+    if (it != m_index.end())
+        return it->second;
+
+    const std::uint32_t symbol = m_size.load(std::memory_order_relaxed);
+    const size_t chunk = symbol / CHUNK_SIZE;
+    if (chunk >= MAX_CHUNKS)
+        throw std::length_error("Symbol table is full");
+    if (!m_chunks[chunk])
+        m_chunks[chunk] = std::make_unique<std::string[]>(CHUNK_SIZE);
+
+    std::string &stored = m_chunks[chunk][symbol % CHUNK_SIZE];
+    stored.assign(a_name);
+    m_index.emplace(stored, symbol);
+    // czytelnicy name() widzą wpis dopiero po tym zapisie
+    m_size.store(symbol + 1, std::memory_order_release);
+    return symbol;
+}
+
+auto SymbolTable::find(std::string_view a_name) const -> std::optional<std::uint32_t>
+{
+    std::shared_lock lock(m_mutex);
+    auto it = m_index.find(a_name);
+    if (it == m_index.end())
+        return std::nullopt;
+    return it->second;
+}
+
+auto SymbolTable::name(std::uint32_t a_symbol) const -> const std::string &
+{
+    static const std::string empty;
+
+    if (a_symbol >= m_size.load(std::memory_order_acquire))
+        return empty;
+    return m_chunks[a_symbol / CHUNK_SIZE][a_symbol % CHUNK_SIZE];
+}
+
+auto SymbolTable::size() const -> size_t
+{
+    return m_size.load(std::memory_order_acquire);
+}
+
+auto Symbol::find(std::string_view a_name) -> std::optional<Symbol>
+{
+    auto value = SymbolTable::global().find(a_name);
+    if (!value.has_value())
+        return std::nullopt;
+
+    Symbol symbol;
+    symbol.m_value = *value;
+    return symbol;
+}
+
+auto Symbol::str() const -> const std::string &
+{
+    return SymbolTable::global().name(m_value);
+}
+
+auto operator<<(std::ostream &a_stream, const Symbol &a_symbol) -> std::ostream &
+{
+    return a_stream << a_symbol.str();
+}
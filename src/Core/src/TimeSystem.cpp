@@ -1,4 +1,6 @@
 #include "../header/TimeSystem.hpp"
+#include "../header/Snapshot.hpp"
+#include <algorithm>
 #include <stdexcept>
 
 using std::move;
@@ -49,78 +51,98 @@ auto DateModel::year(unsigned short a_year) -> void
 
     m_year = a_year;
 }
-auto constexpr DateModel::daysInMonth(unsigned short month, unsigned short year) -> unsigned short
+auto DateModel::fromCalendarIndex(unsigned short a_index) -> DateModel
 {
-    switch (month)
-    {
-    case 1:
-        return 31;
-    case 2:
-        return isLeap(year) ? 29 : 28;
-    case 3:
-        return 31;
-    case 4:
-        return 30;
-    case 5:
-        return 31;
-    case 6:
-        return 30;
-    case 7:
-        return 31;
-    case 8:
-        return 31;
-    case 9:
-        return 30;
-    case 10:
-        return 31;
-    case 11:
-        return 30;
-    case 12:
-        return 31;
-    }
-    return 0;
+    if (a_index >= CALENDAR_DAY_COUNT)
+        throw range_error("Date out of range");
+
+    const auto &entry = calendarEntry(a_index);
+    DateModel date;
+    date.m_day = entry.m_day;
+    date.m_month = entry.m_month;
+    date.m_year = entry.m_year;
+    return date;
 }
 
-auto DateModel::nextDay() -> void
+auto DateModel::daysUntilNextMonth() const -> unsigned short
 {
-    m_day++;
-
-    if (m_day > daysInMonth(m_month, m_year))
-    {
-        m_day = 1;
-        m_month++;
-
-        if (m_month > MAX_DATA_MONTH)
-        {
-            m_month = MIN_DATA_MONTH;
-            m_year++;
+    return daysInMonth(m_month, m_year) - m_day + 1;
+}
 
-            if (m_year > MAX_DATA_YEAR)
-            {
-                throw range_error("Date out of range");
-            }
-        }
-    }
+auto DateModel::nextDay() -> void
+{
+    *this = fromCalendarIndex(calendarIndex() + 1);
 }
 
 TimeDataModel::TimeDataModel()
     : m_currentDate(MIN_DATA_DAY, MIN_DATA_MONTH, MIN_DATA_YEAR),
       m_currentGameDay(MIN_GAME_DAY),
-      m_currentDayOfWeek(DayOfWeek::THURSDAY) // 1st Jan 1942 was a Thursday
+      m_currentDayOfWeek(dayOfWeekOfGameDay(MIN_GAME_DAY)),
+      m_dayObservers(std::make_shared<ObserverRegistry<DayPassedCallback>>()),
+      m_daysObservers(std::make_shared<ObserverRegistry<DaysPassedCallback>>()),
+      m_batchLimits(std::make_shared<ObserverRegistry<BatchLimitCallback>>())
 {
 }
 
-auto TimeDataModel::nextDay() -> void
+TimeDataModel::TimeDataModel(const TimeDataModel &a_other)
+    : m_currentDate(a_other.m_currentDate),
+      m_currentGameDay(a_other.m_currentGameDay),
+      m_currentDayOfWeek(a_other.m_currentDayOfWeek),
+      m_dayObservers(std::make_shared<ObserverRegistry<DayPassedCallback>>()),
+      m_daysObservers(std::make_shared<ObserverRegistry<DaysPassedCallback>>()),
+      m_batchLimits(std::make_shared<ObserverRegistry<BatchLimitCallback>>())
 {
-    // 1) następny dzień kalendarza
-    m_currentDate.nextDay();
+}
 
-    // 2) przesuwamy dzień tygodnia
-    m_currentDayOfWeek = static_cast<DayOfWeek>(
-        (static_cast<int>(m_currentDayOfWeek) + 1) % 7);
+auto TimeDataModel::operator=(const TimeDataModel &a_other) -> TimeDataModel &
+{
+    m_currentDate = a_other.m_currentDate;
+    m_currentGameDay = a_other.m_currentGameDay;
+    m_currentDayOfWeek = a_other.m_currentDayOfWeek;
+    return *this;
+}
 
-    // 3) zwiększamy licznik dni gry
-    m_currentGameDay++;
+auto TimeDataModel::dateOfGameDay(unsigned short a_gameDay) -> DateModel
+{
+    if (a_gameDay < MIN_GAME_DAY || a_gameDay > MAX_GAME_DAY)
+        throw range_error("Game day out of range");
+
+    return DateModel::fromCalendarIndex(gameDayToCalendarIndex(a_gameDay));
+}
+
+auto TimeDataModel::dayOfWeekOfGameDay(unsigned short a_gameDay) -> DayOfWeek
+{
+    if (a_gameDay < MIN_GAME_DAY || a_gameDay > MAX_GAME_DAY)
+        throw range_error("Game day out of range");
+
+    return calendarEntry(gameDayToCalendarIndex(a_gameDay)).m_dayOfWeek;
+}
+
+auto TimeDataModel::gameDayOfDate(const DateModel &a_date) -> unsigned short
+{
+    const unsigned short gameDay = calendarIndexToGameDay(a_date.calendarIndex());
+    if (gameDay > MAX_GAME_DAY)
+        throw range_error("Date after the last game day");
+
+    return gameDay;
+}
+
+auto TimeDataModel::jumpToGameDay(unsigned short a_gameDay) -> void
+{
+    // data i dzień tygodnia z jednego wpisu tablicy kalendarza
+    m_currentDate = DateModel::fromCalendarIndex(gameDayToCalendarIndex(a_gameDay));
+    m_currentDayOfWeek = calendarEntry(gameDayToCalendarIndex(a_gameDay)).m_dayOfWeek;
+    m_currentGameDay = a_gameDay;
+}
+
+auto TimeDataModel::stepDate() -> void
+{
+    jumpToGameDay(m_currentGameDay + 1);
+}
+
+auto TimeDataModel::nextDay() -> void
+{
+    stepDate();
 
     // 4) granica symulacji (opcjonalna)
     if (m_currentGameDay > MAX_GAME_DAY)
@@ -130,33 +152,136 @@ auto TimeDataModel::nextDay() -> void
     }
     // 5) powiadamiamy obserwatorów
     notifyDayObservers();
+    notifyDaysObservers(m_currentGameDay, 1);
 }
 
 auto TimeDataModel::nextTeenDays() -> void
 {
-    for (int i = 0; i < 10; ++i)
+    advanceDays(10);
+}
+
+auto TimeDataModel::advanceDays(unsigned short a_count) -> void
+{
+    if (a_count == 0)
+        return;
+
+    if (m_currentGameDay + a_count > MAX_GAME_DAY)
+        throw std::range_error("Exceeded maximum game days");
+
+    unsigned short remaining = a_count;
+    while (remaining > 0)
     {
-        nextDay();
+        // paczka kończy się na najbliższym dniu, którego obserwatorzy nie przeskoczą
+        unsigned short batch = remaining;
+        m_batchLimits->dispatch(*this, batch);
+        batch = std::clamp<unsigned short>(batch, 1, remaining);
+
+        const unsigned short firstDay = m_currentGameDay + 1;
+
+        if (m_dayObservers->empty())
+        {
+            // nikt nie potrzebuje pojedynczych dni - sam skok kalendarza
+            jumpToGameDay(m_currentGameDay + batch);
+        }
+        else
+        {
+            for (unsigned short i = 0; i < batch; ++i)
+            {
+                stepDate();
+                notifyDayObservers();
+            }
+        }
+
+        notifyDaysObservers(firstDay, batch);
+        remaining -= batch;
     }
 }
 
+auto TimeDataModel::subscribeDay(DayPassedCallback a_callback, int a_priority) -> ObserverSubscription
+{
+    const auto id = m_dayObservers->add(move(a_callback), a_priority);
+    return ObserverSubscription(m_dayObservers, id);
+}
+
+auto TimeDataModel::subscribeDays(DaysPassedCallback a_callback, int a_priority) -> ObserverSubscription
+{
+    const auto id = m_daysObservers->add(move(a_callback), a_priority);
+    return ObserverSubscription(m_daysObservers, id);
+}
+
+auto TimeDataModel::subscribeBatchLimit(BatchLimitCallback a_callback) -> ObserverSubscription
+{
+    const auto id = m_batchLimits->add(move(a_callback));
+    return ObserverSubscription(m_batchLimits, id);
+}
+
 auto TimeDataModel::addDayObserver(weak_ptr<DayPassedCallback> a_callback) -> void
 {
-    m_dayObservers.push_back(move(a_callback));
+    // martwy callback wypisuje się sam przy pierwszym wywołaniu
+    auto *registry = m_dayObservers.get();
+    const auto id = registry->nextId();
+    registry->add([registry, id, callback = move(a_callback)](const TimeDataModel &a_time)
+                  {
+                      if (auto sp = callback.lock())
+                          (*sp)(a_time);
+                      else
+                          registry->remove(id);
+                  });
+}
+
+auto TimeDataModel::addDaysObserver(weak_ptr<DaysPassedCallback> a_callback) -> void
+{
+    auto *registry = m_daysObservers.get();
+    const auto id = registry->nextId();
+    registry->add([registry, id, callback = move(a_callback)](const TimeDataModel &a_time, unsigned short a_firstDay, unsigned short a_count)
+                  {
+                      if (auto sp = callback.lock())
+                          (*sp)(a_time, a_firstDay, a_count);
+                      else
+                          registry->remove(id);
+                  });
 }
 
 auto TimeDataModel::notifyDayObservers() -> void
 {
-    for (auto it = m_dayObservers.begin(); it != m_dayObservers.end();)
+    m_dayObservers->dispatch(*this);
+}
+
+auto TimeDataModel::notifyDaysObservers(unsigned short a_firstDay, unsigned short a_count) -> void
+{
+    m_daysObservers->dispatch(*this, a_firstDay, a_count);
+}
+auto TimeDataModel::writeSnapshot(SnapshotWriter &a_writer) const -> void
+{
+    a_writer.write(m_currentDate.day());
+    a_writer.write(m_currentDate.month());
+    a_writer.write(m_currentDate.year());
+    a_writer.write(m_currentGameDay);
+    a_writer.write(static_cast<std::uint8_t>(m_currentDayOfWeek));
+}
+
+auto TimeDataModel::readSnapshot(SnapshotReader &a_reader) -> bool
+{
+    unsigned short day = 0, month = 0, year = 0, gameDay = 0;
+    std::uint8_t dayOfWeek = 0;
+    if (!a_reader.read(day) || !a_reader.read(month) || !a_reader.read(year) ||
+        !a_reader.read(gameDay) || !a_reader.read(dayOfWeek))
+        return false;
+
+    if (gameDay < MIN_GAME_DAY || gameDay > MAX_GAME_DAY || dayOfWeek > static_cast<std::uint8_t>(DayOfWeek::SUNDAY))
+        return false;
+
+    try
     {
-        if (auto sp = it->lock())
-        {
-            (*sp)(*this);
-            ++it;
-        }
-        else
-        {
-            it = m_dayObservers.erase(it);
-        }
+        // data musi zgadzać się z dniem gry; dzień tygodnia wynika z kalendarza
+        if (DateModel(day, month, year).calendarIndex() != gameDayToCalendarIndex(gameDay))
+            return false;
+    }
+    catch (const range_error &)
+    {
+        return false;
     }
-}
\ No newline at end of file
+
+    jumpToGameDay(gameDay);
+    return true;
+}
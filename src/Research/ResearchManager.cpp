@@ -1,22 +1,39 @@
 #include "ResearchManager.hpp"
+#include "../Core/header/DataCache.hpp"
+#include "../Core/header/Snapshot.hpp"
+#include "../Resources/BudgetForecast.hpp"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <numbers>
 #include <nlohmann/json.hpp>
 
 using std::make_shared;
 using json = nlohmann::json;
 using std::ifstream;
+using std::max;
+using std::min;
 using std::move;
 
 ResearchManager::ResearchManager(TimeDataModel& timeModel, ResourcesManager& resources)
     : m_timeModel(timeModel), m_resources(resources)
 {
-    // Register as observer
-    m_dayObserverHandle = make_shared<TimeDataModel::DayPassedCallback>(
-        [this](const TimeDataModel& t) { onDayPassed(t); }
-    );
+    // Register as observer (po zasobach)
+    m_daysSubscription = m_timeModel.subscribeDays(
+        [this](const TimeDataModel& t, unsigned short firstDay, unsigned short count)
+        { onDaysPassed(t, firstDay, count); },
+        OBSERVER_PRIORITY_RESEARCH);
 
-    m_timeModel.addDayObserver(m_dayObserverHandle);
+    // paczka dni kończy się na ukończeniu badania - zasoby liczą koszt dzienny
+    // w postaci zamkniętej, a listenery/kolejka startują kolejne badania w dniu ukończenia
+    m_batchLimitSubscription = m_timeModel.subscribeBatchLimit(
+        [this](const TimeDataModel&, unsigned short& maxDays)
+        {
+            if (auto days = daysUntilNextCompletion())
+                maxDays = min(maxDays, *days);
+        });
 }
 
 void ResearchManager::loadFromJson(const string& path)
@@ -27,7 +44,7 @@ void ResearchManager::loadFromJson(const string& path)
     for (auto& t : data["technologies"])
     {
         Technology tech;
-        tech.m_id = t["id"];
+        tech.m_id = t["id"].get<string>();
         tech.m_name = t["name"];
         tech.m_type =
             (t["type"] == "engineering" ? TechnologyType::Engineering : TechnologyType::Theory);
@@ -36,8 +53,15 @@ void ResearchManager::loadFromJson(const string& path)
         tech.m_moneyCost = t["money_cost"];
         tech.m_daylyCost = t["dayly_cost"];
 
+        // opcjonalny rozkład czasu i szansa porażki (tryb Randomized)
+        tech.m_researchDaysMin = t.value("research_days_min", tech.m_researchDays);
+        tech.m_researchDaysMax = t.value("research_days_max", tech.m_researchDays);
+        if (tech.m_researchDaysMax < tech.m_researchDaysMin)
+            std::swap(tech.m_researchDaysMin, tech.m_researchDaysMax);
+        tech.m_failureProbability = std::clamp(t.value("failure_probability", 0.f), 0.f, MAX_FAILURE_PROBABILITY);
+
         for (auto& pre : t["prerequisites"])
-            tech.m_prerequisites.push_back(pre);
+            tech.m_prerequisites.push_back(pre.get<string>());
 
         tech.m_uraniumRequired = t.value("uranium_required", 0u);
         tech.m_plutoniumRequired = t.value("plutonium_required", 0u);
@@ -47,52 +71,247 @@ void ResearchManager::loadFromJson(const string& path)
         tech.m_armyPersonnelRequired = t.value("army_personnel_required", 0u);
 
         for (auto& building : t["building_required"])
-            tech.m_buildingRequired.push_back(building);
+            tech.m_buildingRequired.push_back(building.get<string>());
 
         for (auto& character : t["characters_involved"])
-            tech.m_charactersInvolved.push_back(character);
+            tech.m_charactersInvolved.push_back(character.get<string>());
 
-        m_techs[tech.m_id] = tech;
-        
+        // powtórzone id nadpisuje wcześniejszą definicję
+        auto existing = findTechnology(tech.m_id);
+        if (existing.has_value())
+        {
+            m_techs[*existing] = move(tech);
+        }
+        else
+        {
+            m_techs.push_back(move(tech));
+            indexTechnology(static_cast<TechId>(m_techs.size() - 1));
+        }
     }
 
+    compileGraph();
     updateAvailability();
+    syncResearchCost();
+    m_stateObservers->dispatch(INVALID_TECH_ID);
 }
 
-void ResearchManager::updateAvailability()
+void ResearchManager::loadTechnologies(vector<Technology> techs)
 {
-    for (auto& [id, tech] : m_techs)
+    m_techs = move(techs);
+    m_activeSlots.clear();
+    m_assignedPersonnel.fill(0);
+    m_researchQueue.clear();
+    m_queueVersion++;
+
+    for (auto &tech : m_techs)
     {
-        if (tech.isCompleted()) continue;
-        if (tech.isInProgress()) continue;
+        tech.m_state = ResearchState::Locked;
+        tech.m_progressDays = 0;
+    }
+
+    m_techBySymbol.clear();
+    for (TechId i = 0; i < m_techs.size(); ++i)
+        indexTechnology(i);
+
+    compileGraph();
+    updateAvailability();
+    syncResearchCost();
+    m_stateObservers->dispatch(INVALID_TECH_ID);
+}
+
+void ResearchManager::indexTechnology(TechId techId)
+{
+    const Symbol id = m_techs[techId].m_id;
+    if (!id.isValid())
+        return;
+
+    if (id.value() >= m_techBySymbol.size())
+        m_techBySymbol.resize(id.value() + 1, INVALID_TECH_ID);
+    m_techBySymbol[id.value()] = techId;
+}
+
+void ResearchManager::compileGraph()
+{
+    const size_t count = m_techs.size();
+    m_graphVersion++;
+
+    for (TechId i = 0; i < count; ++i)
+        m_techs[i].m_index = i;
 
-        bool allDone = true;
-        for (auto& pre : tech.m_prerequisites)
+    m_prerequisiteOffsets.assign(count + 1, 0);
+    m_prerequisiteIds.clear();
+    m_unresolvedPrerequisites.assign(count, 0);
+    vector<unsigned> dependentCounts(count, 0);
+
+    // 1) wymagania: symbol -> indeks (odczyt z tablicy, bez hashowania)
+    for (TechId i = 0; i < count; ++i)
+    {
+        m_prerequisiteOffsets[i] = static_cast<unsigned>(m_prerequisiteIds.size());
+
+        for (const auto &pre : m_techs[i].m_prerequisites)
         {
-            auto it = m_techs.find(pre);
-            if (it == m_techs.end() || !it->second.isCompleted())
+            const auto prerequisite = findTechnology(pre);
+            if (!prerequisite.has_value())
             {
-                allDone = false;
-                break;
+                m_unresolvedPrerequisites[i]++;
+                continue;
             }
+
+            m_prerequisiteIds.push_back(*prerequisite);
+            dependentCounts[*prerequisite]++;
+        }
+    }
+    m_prerequisiteOffsets[count] = static_cast<unsigned>(m_prerequisiteIds.size());
+
+    // 2) odwrócone krawędzie: technologie zależne
+    m_dependentOffsets.assign(count + 1, 0);
+    for (TechId i = 0; i < count; ++i)
+        m_dependentOffsets[i + 1] = m_dependentOffsets[i] + dependentCounts[i];
+
+    m_dependentIds.assign(m_prerequisiteIds.size(), INVALID_TECH_ID);
+    vector<unsigned> cursor(m_dependentOffsets.begin(), m_dependentOffsets.end() - 1);
+    for (TechId i = 0; i < count; ++i)
+    {
+        for (TechId pre : getPrerequisites(i))
+            m_dependentIds[cursor[pre]++] = i;
+    }
+
+    // 3) kolejność topologiczna (Kahn); technologie na cyklach do niej nie trafiają
+    m_topologicalOrder.clear();
+    m_topologicalOrder.reserve(count);
+    vector<unsigned> indegree(count);
+    for (TechId i = 0; i < count; ++i)
+    {
+        indegree[i] = static_cast<unsigned>(getPrerequisites(i).size());
+        if (indegree[i] == 0)
+            m_topologicalOrder.push_back(i);
+    }
+    for (size_t head = 0; head < m_topologicalOrder.size(); ++head)
+    {
+        for (TechId dependent : getDependents(m_topologicalOrder[head]))
+        {
+            if (--indegree[dependent] == 0)
+                m_topologicalOrder.push_back(dependent);
+        }
+    }
+}
+
+void ResearchManager::updateAvailability()
+{
+    m_remainingPrerequisites.assign(m_techs.size(), 0);
+
+    for (auto &tech : m_techs)
+    {
+        unsigned remaining = m_unresolvedPrerequisites[tech.m_index];
+        for (TechId pre : getPrerequisites(tech.m_index))
+        {
+            if (!m_techs[pre].isCompleted())
+                remaining++;
         }
+        m_remainingPrerequisites[tech.m_index] = remaining;
+
+        if (tech.isCompleted()) continue;
+        if (tech.isInProgress()) continue;
+
+        if (remaining == 0)
+            tech.m_state = ResearchState::Available;
+    }
+}
+
+void ResearchManager::updateAvailabilityOfDependents(TechId completed)
+{
+    for (TechId dependent : getDependents(completed))
+    {
+        if (--m_remainingPrerequisites[dependent] != 0)
+            continue;
 
-        if (allDone)
+        Technology &tech = m_techs[dependent];
+        if (tech.m_state == ResearchState::Locked)
             tech.m_state = ResearchState::Available;
     }
 }
 
+optional<TechId> ResearchManager::findTechnology(Symbol techId) const
+{
+    if (!techId.isValid() || techId.value() >= m_techBySymbol.size() ||
+        m_techBySymbol[techId.value()] == INVALID_TECH_ID)
+        return std::nullopt;
+    return m_techBySymbol[techId.value()];
+}
+
+optional<TechId> ResearchManager::findTechnology(const string &techId) const
+{
+    // find zamiast konstruktora - zapytanie o nieznane id nie rozrasta tablicy symboli
+    auto symbol = Symbol::find(techId);
+    if (!symbol.has_value())
+        return std::nullopt;
+    return findTechnology(*symbol);
+}
+
+optional<TechId> ResearchManager::findTechnology(const char *techId) const
+{
+    auto symbol = Symbol::find(techId);
+    if (!symbol.has_value())
+        return std::nullopt;
+    return findTechnology(*symbol);
+}
+
+span<const TechId> ResearchManager::getPrerequisites(TechId techId) const
+{
+    return span<const TechId>(m_prerequisiteIds).subspan(
+        m_prerequisiteOffsets[techId],
+        m_prerequisiteOffsets[techId + 1] - m_prerequisiteOffsets[techId]);
+}
+
+span<const TechId> ResearchManager::getDependents(TechId techId) const
+{
+    return span<const TechId>(m_dependentIds).subspan(
+        m_dependentOffsets[techId],
+        m_dependentOffsets[techId + 1] - m_dependentOffsets[techId]);
+}
+
 bool ResearchManager::startResearch(const string& techId)
 {
-    auto it = m_techs.find(techId);
-    if (it == m_techs.end())
+    auto id = findTechnology(techId);
+    if (!id.has_value())
+        return false;
+
+    return startResearch(*id);
+}
+
+bool ResearchManager::startResearch(TechId techId)
+{
+    if (techId >= m_techs.size())
         return false;
 
-    Technology& tech = it->second;
+    Technology& tech = m_techs[techId];
 
-    if (!tech.isAvailable() && !tech.isInProgress())
+    // już trwa we własnym slocie
+    if (tech.isInProgress())
+        return true;
+
+    if (!tech.isAvailable())
         return false;
 
+    ResourceMissing missing = checkMissingResources(tech);
+
+    // Jeśli cokolwiek brakuje → event + abort
+    if (missing.money || missing.uranium || missing.plutonium ||
+        missing.scientists || missing.engineers ||
+        missing.workers || missing.army)
+    {
+        for (auto& cb : m_missingResourcesListeners)
+            cb(missing);
+
+        return false;
+    }
+
+    beginResearch(tech);
+    return true;
+}
+
+ResourceMissing ResearchManager::checkMissingResources(const Technology& tech) const
+{
     ResourceMissing missing;
 
     if (m_resources.getMoney() < tech.m_moneyCost)
@@ -103,101 +322,318 @@ bool ResearchManager::startResearch(const string& techId)
 
     if (m_resources.getPlutonium() < tech.m_plutoniumRequired)
         missing.plutonium = true;
-    
-    if (m_resources.getWorkingScientists() < tech.m_scientistsRequired)
+
+    // personel zajęty innymi badaniami nie jest wolny
+    auto freePersonnel = [&](PersonnelRole role)
+    {
+        return m_resources.getWorking(role) - std::min(m_resources.getWorking(role), m_assignedPersonnel[roleIndex(role)]);
+    };
+
+    if (freePersonnel(PersonnelRole::Scientists) < tech.m_scientistsRequired)
         missing.scientists = true;
 
-    if (m_resources.getWorkingEngineers() < tech.m_engineersRequired)
+    if (freePersonnel(PersonnelRole::Engineers) < tech.m_engineersRequired)
         missing.engineers = true;
 
-    if (m_resources.getWorkingWorkers() < tech.m_workersRequired)
+    if (freePersonnel(PersonnelRole::Workers) < tech.m_workersRequired)
         missing.workers = true;
 
-    if (m_resources.getWorkingArmyPersonnel() < tech.m_armyPersonnelRequired)
+    if (freePersonnel(PersonnelRole::ArmyPersonnel) < tech.m_armyPersonnelRequired)
         missing.army = true;
 
-    // Jeśli cokolwiek brakuje → event + abort
-    if (missing.money || missing.uranium || missing.plutonium ||
-        missing.scientists || missing.engineers ||
-        missing.workers || missing.army)
-    {
-        for (auto& cb : m_missingResourcesListeners)
-            cb(missing);
+    return missing;
+}
+
+void ResearchManager::beginResearch(Technology& tech)
+{
+    // koszt jednorazowy
+    m_resources.spendMoney(tech.m_moneyCost);
+    tech.m_state = ResearchState::InProgress;
+
+    ActiveResearch slot;
+    slot.m_techId = tech.m_index;
+    slot.m_progressDays = tech.m_progressDays;
+    slot.m_researchDays = max(sampleResearchDays(tech), slot.m_progressDays);
+    slot.m_assignedPersonnel = tech.requiredPersonnel();
 
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+        m_assignedPersonnel[i] += slot.m_assignedPersonnel[i];
+
+    m_activeSlots.push_back(slot);
+    syncResearchCost();
+    dequeueResearch(tech.m_index);
+    m_stateObservers->dispatch(tech.m_index);
+}
+
+bool ResearchManager::queueResearch(const string& techId, int priority)
+{
+    auto id = findTechnology(techId);
+    if (!id.has_value())
         return false;
-    }
 
-    // koszt jednorazowy
-    if (!tech.isInProgress())
-    {
-        m_resources.spendMoney(tech.m_moneyCost);
-        tech.m_state = ResearchState::InProgress;
-    }
+    return queueResearch(*id, priority);
+}
+
+bool ResearchManager::queueResearch(TechId techId, int priority)
+{
+    if (techId >= m_techs.size())
+        return false;
+
+    const Technology& tech = m_techs[techId];
+    if (tech.isCompleted() || tech.isInProgress())
+        return false;
+
+    dequeueResearch(techId);
+
+    QueuedResearch entry{techId, priority, m_queueSequence++};
+    auto position = std::upper_bound(
+        m_researchQueue.begin(), m_researchQueue.end(), entry,
+        [](const QueuedResearch& a, const QueuedResearch& b)
+        {
+            return a.m_priority != b.m_priority ? a.m_priority > b.m_priority
+                                                : a.m_sequence < b.m_sequence;
+        });
+    m_researchQueue.insert(position, entry);
+    m_queueVersion++;
 
-    m_activeResearchId = tech.m_id;
+    startQueuedResearch();
     return true;
 }
 
+bool ResearchManager::dequeueResearch(TechId techId)
+{
+    auto it = std::find_if(m_researchQueue.begin(), m_researchQueue.end(),
+                           [&](const QueuedResearch& q) { return q.m_techId == techId; });
+    if (it == m_researchQueue.end())
+        return false;
 
-void ResearchManager::onDayPassed(const TimeDataModel& time)
+    m_researchQueue.erase(it);
+    m_queueVersion++;
+    return true;
+}
+
+void ResearchManager::startQueuedResearch()
 {
-    if (!m_activeResearchId.has_value())
+    for (size_t i = 0; i < m_researchQueue.size();)
+    {
+        Technology& tech = m_techs[m_researchQueue[i].m_techId];
+        ResourceMissing missing = checkMissingResources(tech);
+
+        const bool canStart = tech.isAvailable() &&
+            !(missing.money || missing.uranium || missing.plutonium ||
+              missing.scientists || missing.engineers ||
+              missing.workers || missing.army);
+
+        if (canStart)
+            beginResearch(tech); // usuwa wpis z kolejki
+        else
+            ++i;
+    }
+}
+
+unsigned ResearchManager::sampleResearchDays(const Technology& tech)
+{
+    if (m_outcomeMode == ResearchOutcomeMode::Deterministic)
+        return tech.m_researchDays;
+
+    std::uniform_int_distribution<unsigned> days(tech.minResearchDays(), tech.maxResearchDays());
+    return days(m_outcomeRng);
+}
+
+void ResearchManager::releaseSlot(TechId techId)
+{
+    auto slot = std::find_if(m_activeSlots.begin(), m_activeSlots.end(),
+                             [&](const ActiveResearch& s) { return s.m_techId == techId; });
+    if (slot == m_activeSlots.end())
         return;
 
-    auto it = m_techs.find(*m_activeResearchId);
-    if (it == m_techs.end())
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+        m_assignedPersonnel[i] -= slot->m_assignedPersonnel[i];
+    m_activeSlots.erase(slot);
+    syncResearchCost();
+}
+
+void ResearchManager::syncResearchCost()
+{
+    m_resources.setResearchDailyCost(activeResearchDailyCost());
+}
+
+void ResearchManager::finishResearch(TechId techId)
+{
+    const Technology& tech = m_techs[techId];
+
+    if (m_outcomeMode == ResearchOutcomeMode::Randomized && tech.m_failureProbability > 0.f)
     {
-        m_activeResearchId.reset();
-        return;
+        std::bernoulli_distribution failed(min(tech.m_failureProbability, MAX_FAILURE_PROBABILITY));
+        if (failed(m_outcomeRng))
+        {
+            failResearch(techId);
+            return;
+        }
     }
 
-    Technology& tech = it->second;
-    tech.m_progressDays++;
+    completeResearch(techId);
+}
+
+void ResearchManager::failResearch(TechId techId)
+{
+    releaseSlot(techId);
+
+    // próba przepada - trzeba zacząć od nowa (i znów zapłacić)
+    Technology& tech = m_techs[techId];
+    tech.m_progressDays = 0;
+    tech.m_state = ResearchState::Available;
+    m_stateObservers->dispatch(techId);
+
+    startQueuedResearch();
+
+    for (auto& cb : m_researchFailedListeners)
+        cb(tech);
+}
 
-    if (tech.m_progressDays >= tech.m_researchDays)
+void ResearchManager::completeResearch(TechId techId)
+{
+    releaseSlot(techId);
+
+    Technology& tech = m_techs[techId];
+    tech.m_state = ResearchState::Completed;
+    updateAvailabilityOfDependents(techId);
+    m_stateObservers->dispatch(techId);
+
+    // zwolniony personel -> następne z kolejki
+    startQueuedResearch();
+
+    // Notify listeners
+    for (auto& cb : m_researchCompletedListeners)
+        cb(tech);
+}
+
+
+void ResearchManager::onDayPassed(const TimeDataModel& time)
+{
+    onDaysPassed(time, time.currentGameDay(), 1);
+}
+
+void ResearchManager::onDaysPassed(const TimeDataModel&, unsigned short, unsigned short count)
+{
+    unsigned remaining = count;
+    vector<TechId> finished;
+
+    // Skok od ukończenia do ukończenia. Paczki z TimeDataModel kończą się już na
+    // ukończeniu (limit paczki); pętla obsługuje dłuższe paczki wywołań bezpośrednich.
+    // Listener może od razu uruchomić kolejne badanie - dalsze dni idą również na nie.
+    while (remaining > 0 && !m_activeSlots.empty())
     {
-        tech.m_state = ResearchState::Completed;
-        // Notify listeners
-        for (auto& cb : m_researchCompletedListeners)
-            cb(tech);
-        m_activeResearchId.reset();
-        updateAvailability();
+        // dni do najbliższego ukończenia (badanie 0-dniowe też kończy się po 1 dniu)
+        unsigned step = remaining;
+        for (const auto& slot : m_activeSlots)
+        {
+            unsigned daysLeft = slot.m_researchDays > slot.m_progressDays
+                                    ? slot.m_researchDays - slot.m_progressDays
+                                    : 1;
+            step = min(step, daysLeft);
+        }
+
+        finished.clear();
+        for (auto& slot : m_activeSlots)
+        {
+            slot.m_progressDays += step;
+            m_techs[slot.m_techId].m_progressDays = slot.m_progressDays;
+
+            if (slot.m_progressDays >= slot.m_researchDays)
+                finished.push_back(slot.m_techId);
+        }
+        remaining -= step;
+
+        for (TechId techId : finished)
+            finishResearch(techId);
     }
 }
 
 
+bool ResearchManager::isCompleted(TechId techId) const
+{
+    return techId < m_techs.size() && m_techs[techId].isCompleted();
+}
+
+bool ResearchManager::isAvailable(TechId techId) const
+{
+    return techId < m_techs.size() && m_techs[techId].isAvailable();
+}
+
+float ResearchManager::getProgress(TechId techId) const
+{
+    const ActiveResearch* slot = getActiveSlot(techId);
+    if (slot == nullptr) return 0.f;
+
+    return float(slot->m_progressDays) / float(max(slot->m_researchDays, 1u));
+}
+
 bool ResearchManager::isCompleted(const string& techId) const
 {
-    auto it = m_techs.find(techId);
-    return it != m_techs.end() && it->second.isCompleted();
+    return isCompleted(findTechnology(techId).value_or(INVALID_TECH_ID));
 }
 
 bool ResearchManager::isAvailable(const string& techId) const
 {
-    auto it = m_techs.find(techId);
-    return it != m_techs.end() && it->second.isAvailable();
+    return isAvailable(findTechnology(techId).value_or(INVALID_TECH_ID));
 }
 
 float ResearchManager::getProgress(const string& techId) const
 {
-    auto it = m_techs.find(techId);
-    if (it == m_techs.end()) return 0.f;
-
-    if (!it->second.isInProgress()) return 0.f;
+    return getProgress(findTechnology(techId).value_or(INVALID_TECH_ID));
+}
 
-    return float(it->second.m_progressDays) / float(it->second.m_researchDays);
+const ActiveResearch* ResearchManager::getActiveSlot(TechId techId) const
+{
+    auto slot = std::find_if(m_activeSlots.begin(), m_activeSlots.end(),
+                             [techId](const ActiveResearch& s) { return s.m_techId == techId; });
+    return slot == m_activeSlots.end() ? nullptr : &*slot;
 }
 
 const Technology* ResearchManager::getActiveResearch() const
 {
-    if (!m_activeResearchId.has_value())
+    if (m_activeSlots.empty())
         return nullptr;
 
-    auto it = m_techs.find(*m_activeResearchId);
-    if (it == m_techs.end())
-        return nullptr;
+    return &m_techs[m_activeSlots.front().m_techId];
+}
+
+optional<unsigned short> ResearchManager::daysUntilNextCompletion() const
+{
+    if (m_activeSlots.empty())
+        return std::nullopt;
+
+    unsigned days = MAX_GAME_DAY;
+    for (const auto& slot : m_activeSlots)
+    {
+        unsigned daysLeft = slot.m_researchDays > slot.m_progressDays
+                                ? slot.m_researchDays - slot.m_progressDays
+                                : 1;
+        days = min(days, daysLeft);
+    }
+
+    return static_cast<unsigned short>(days);
+}
+
+long ResearchManager::activeResearchDailyCost() const
+{
+    long cost = 0;
+    for (const auto& slot : m_activeSlots)
+        cost += m_techs[slot.m_techId].m_daylyCost;
+    return cost;
+}
 
-    return &it->second;
+void ResearchManager::addResearchCosts(BudgetForecast& forecast) const
+{
+    for (const auto& slot : m_activeSlots)
+    {
+        const unsigned daysLeft = slot.m_researchDays > slot.m_progressDays
+                                      ? slot.m_researchDays - slot.m_progressDays
+                                      : 1;
+        forecast.addCostChange(static_cast<unsigned short>(min<unsigned>(daysLeft + 1, USHRT_MAX)),
+                               -static_cast<long>(m_techs[slot.m_techId].m_daylyCost));
+    }
 }
 
 void ResearchManager::calculateResearchTime(Technology& tech)
@@ -216,4 +652,429 @@ void ResearchManager::addResearchMissingResourcesListener(
     ResearchMissingResourcesCallback cb)
 {
     m_missingResourcesListeners.push_back(std::move(cb));
-}
\ No newline at end of file
+}
+
+void ResearchManager::addResearchFailedListener(ResearchFailedCallback cb)
+{
+    m_researchFailedListeners.push_back(move(cb));
+}
+
+ObserverSubscription ResearchManager::subscribeStateChanged(ResearchStateChangedCallback cb) const
+{
+    const auto id = m_stateObservers->add(move(cb));
+    return ObserverSubscription(m_stateObservers, id);
+}
+
+void ResearchManager::setOutcomeMode(ResearchOutcomeMode mode, std::uint64_t seed)
+{
+    m_outcomeMode = mode;
+    m_outcomeRng.seed(seed);
+}
+
+namespace
+{
+    // Wartość oczekiwana i wariancja czasu (w dniach).
+    struct Moments
+    {
+        double m_mean = 0.0;
+        double m_variance = 0.0;
+    };
+
+    // Równomierny rozkład dyskretny na [low, high].
+    Moments uniformDays(unsigned low, unsigned high)
+    {
+        const double n = double(high) - double(low) + 1.0;
+        return {(double(low) + double(high)) / 2.0, (n * n - 1.0) / 12.0};
+    }
+
+    // Suma N niezależnych prób, N ~ geometryczny (pierwszy sukces, szansa sukcesu q):
+    // E = E[D] / q, Var = Var[D] / q + p * E[D]^2 / q^2.
+    Moments withRetries(Moments attempt, double failure)
+    {
+        const double success = 1.0 - failure;
+        return {attempt.m_mean / success,
+                attempt.m_variance / success + failure * attempt.m_mean * attempt.m_mean / (success * success)};
+    }
+
+    // max(X, Y) dla niezależnych zmiennych o rozkładach ~normalnych (Clark, 1961).
+    Moments clarkMax(Moments x, Moments y)
+    {
+        const double theta = std::sqrt(x.m_variance + y.m_variance);
+        if (theta < 1e-9)
+            return x.m_mean >= y.m_mean ? x : y;
+
+        const double alpha = (x.m_mean - y.m_mean) / theta;
+        const double pdf = std::exp(-0.5 * alpha * alpha) / std::sqrt(2.0 * std::numbers::pi);
+        const double cdf = 0.5 * std::erfc(-alpha / std::sqrt(2.0));
+
+        const double mean = x.m_mean * cdf + y.m_mean * (1.0 - cdf) + theta * pdf;
+        const double second = (x.m_mean * x.m_mean + x.m_variance) * cdf +
+                              (y.m_mean * y.m_mean + y.m_variance) * (1.0 - cdf) +
+                              (x.m_mean + y.m_mean) * theta * pdf;
+        return {mean, max(0.0, second - mean * mean)};
+    }
+}
+
+vector<ResearchEstimate> ResearchManager::estimateAllCompletions() const
+{
+    vector<ResearchEstimate> estimates(m_techs.size());
+    const bool randomized = m_outcomeMode == ResearchOutcomeMode::Randomized;
+
+    // badanie 0-dniowe też zajmuje 1 dzień (jak w onDaysPassed)
+    auto attemptOf = [&](const Technology& tech) -> Moments
+    {
+        if (!randomized)
+            return {double(max<unsigned>(tech.m_researchDays, 1u)), 0.0};
+        return uniformDays(max<unsigned>(tech.minResearchDays(), 1u), max<unsigned>(tech.maxResearchDays(), 1u));
+    };
+    auto failureOf = [&](const Technology& tech) -> double
+    {
+        return randomized ? double(min(tech.m_failureProbability, MAX_FAILURE_PROBABILITY)) : 0.0;
+    };
+
+    for (TechId id : m_topologicalOrder)
+    {
+        const Technology& tech = m_techs[id];
+        ResearchEstimate& estimate = estimates[id];
+
+        if (tech.isCompleted())
+        {
+            estimate.m_reachable = true;
+            continue;
+        }
+
+        const double failure = failureOf(tech);
+        const Moments full = withRetries(attemptOf(tech), failure);
+
+        if (tech.isInProgress())
+        {
+            auto slot = std::find_if(m_activeSlots.begin(), m_activeSlots.end(),
+                                     [&](const ActiveResearch& s) { return s.m_techId == id; });
+            const unsigned progress = slot != m_activeSlots.end() ? slot->m_progressDays : tech.m_progressDays;
+
+            // reszta bieżącej próby: w trybie losowym czas próby > postęp (inaczej już by się skończyła)
+            Moments rest{1.0, 0.0};
+            if (!randomized && slot != m_activeSlots.end())
+                rest = {double(max(slot->m_researchDays, progress + 1) - progress), 0.0};
+            else if (randomized && max<unsigned>(tech.maxResearchDays(), 1u) > progress)
+            {
+                rest = uniformDays(max<unsigned>(tech.minResearchDays(), progress + 1), tech.maxResearchDays());
+                rest.m_mean -= progress;
+            }
+
+            // porażka bieżącej próby -> pełne badanie od nowa
+            estimate.m_expectedDays = rest.m_mean + failure * full.m_mean;
+            estimate.m_variance = rest.m_variance + failure * full.m_variance +
+                                  failure * (1.0 - failure) * full.m_mean * full.m_mean;
+            estimate.m_reachable = true;
+            continue;
+        }
+
+        if (m_unresolvedPrerequisites[id] > 0)
+            continue;
+
+        Moments start;
+        bool reachable = true;
+        for (TechId pre : getPrerequisites(id))
+        {
+            if (!estimates[pre].m_reachable)
+            {
+                reachable = false;
+                break;
+            }
+            start = clarkMax(start, {estimates[pre].m_expectedDays, estimates[pre].m_variance});
+        }
+        if (!reachable)
+            continue;
+
+        estimate.m_expectedDays = start.m_mean + full.m_mean;
+        estimate.m_variance = start.m_variance + full.m_variance;
+        estimate.m_reachable = true;
+    }
+
+    return estimates;
+}
+
+ResearchEstimate ResearchManager::estimateCompletion(TechId techId) const
+{
+    if (techId >= m_techs.size())
+        return {};
+
+    return estimateAllCompletions()[techId];
+}
+std::uint64_t ResearchManager::technologySetHash() const
+{
+    std::uint64_t hash = 1469598103934665603ull;
+    for (const auto& tech : m_techs)
+    {
+        // po treści, nie po uchwytach - numeracja symboli zależy od kolejności wczytywania
+        for (char c : tech.m_id.str())
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        // separator, żeby {"ab","c"} != {"a","bc"}
+        hash ^= 0xFF;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void ResearchManager::writeSnapshot(SnapshotWriter& writer) const
+{
+    writer.write(static_cast<std::uint32_t>(m_techs.size()));
+    writer.write(technologySetHash());
+
+    for (const auto& tech : m_techs)
+    {
+        writer.write(static_cast<std::uint8_t>(tech.m_state));
+        writer.write(tech.m_progressDays);
+    }
+
+    writer.write(static_cast<std::uint32_t>(m_activeSlots.size()));
+    for (const auto& slot : m_activeSlots)
+    {
+        writer.write(slot.m_techId);
+        writer.write(slot.m_progressDays);
+        writer.write(slot.m_researchDays);
+        writer.write(slot.m_assignedPersonnel);
+    }
+
+    writer.write(static_cast<std::uint32_t>(m_researchQueue.size()));
+    for (const auto& queued : m_researchQueue)
+    {
+        writer.write(queued.m_techId);
+        writer.write(queued.m_priority);
+        writer.write(static_cast<std::uint64_t>(queued.m_sequence));
+    }
+    writer.write(static_cast<std::uint64_t>(m_queueSequence));
+
+    writer.write(static_cast<std::uint8_t>(m_outcomeMode));
+    writer.write(m_outcomeRng.state());
+}
+
+bool ResearchManager::readSnapshot(SnapshotReader& reader)
+{
+    std::uint32_t techCount = 0;
+    std::uint64_t setHash = 0;
+    if (!reader.read(techCount) || !reader.read(setHash))
+        return false;
+
+    if (techCount != m_techs.size() || setHash != technologySetHash())
+    {
+        std::cerr << "Research snapshot does not match loaded technologies\n";
+        return false;
+    }
+
+    struct TechState
+    {
+        std::uint8_t m_state;
+        unsigned m_progressDays;
+    };
+    vector<TechState> states(techCount);
+    for (auto& state : states)
+    {
+        if (!reader.read(state.m_state) || !reader.read(state.m_progressDays))
+            return false;
+        if (state.m_state > static_cast<std::uint8_t>(ResearchState::Completed))
+            return false;
+    }
+
+    std::uint32_t slotCount = 0;
+    if (!reader.read(slotCount) || slotCount > techCount)
+        return false;
+
+    vector<ActiveResearch> slots(slotCount);
+    PersonnelPool::RoleArray assigned{};
+    for (auto& slot : slots)
+    {
+        if (!reader.read(slot.m_techId) || !reader.read(slot.m_progressDays) ||
+            !reader.read(slot.m_researchDays) || !reader.read(slot.m_assignedPersonnel))
+            return false;
+        if (slot.m_techId >= techCount ||
+            states[slot.m_techId].m_state != static_cast<std::uint8_t>(ResearchState::InProgress))
+            return false;
+
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+            assigned[i] += slot.m_assignedPersonnel[i];
+    }
+
+    std::uint32_t queueCount = 0;
+    if (!reader.read(queueCount) || queueCount > techCount)
+        return false;
+
+    vector<QueuedResearch> queue(queueCount);
+    for (auto& queued : queue)
+    {
+        std::uint64_t sequence = 0;
+        if (!reader.read(queued.m_techId) || !reader.read(queued.m_priority) || !reader.read(sequence))
+            return false;
+        if (queued.m_techId >= techCount)
+            return false;
+        queued.m_sequence = sequence;
+    }
+
+    std::uint64_t queueSequence = 0;
+    if (!reader.read(queueSequence))
+        return false;
+
+    std::uint8_t outcomeMode = 0;
+    Xoshiro256::State rngState{};
+    if (!reader.read(outcomeMode) || !reader.read(rngState) ||
+        outcomeMode > static_cast<std::uint8_t>(ResearchOutcomeMode::Randomized))
+        return false;
+
+    Xoshiro256 outcomeRng;
+    if (!outcomeRng.setState(rngState))
+        return false;
+
+    // Wszystko poprawne - podmiana stanu
+    for (auto& tech : m_techs)
+    {
+        const TechState& state = states[tech.m_index];
+        tech.m_state = static_cast<ResearchState>(state.m_state);
+        tech.m_progressDays = state.m_progressDays;
+    }
+    m_activeSlots = move(slots);
+    m_assignedPersonnel = assigned;
+    m_researchQueue = move(queue);
+    m_queueSequence = queueSequence;
+    m_queueVersion++;
+    m_outcomeMode = static_cast<ResearchOutcomeMode>(outcomeMode);
+    m_outcomeRng = outcomeRng;
+
+    // liczniki wymagań wynikają ze stanów
+    updateAvailability();
+    syncResearchCost();
+    m_stateObservers->dispatch(INVALID_TECH_ID);
+    return true;
+}
+
+namespace
+{
+    // "MPTC"
+    const constexpr std::uint32_t TECHNOLOGIES_CACHE_MAGIC = 0x4354504D;
+
+    // Symbole w cache jako napisy - uchwyty są ważne tylko w bieżącym procesie.
+    void writeSymbol(SnapshotWriter& writer, Symbol value)
+    {
+        writer.writeString(value.str());
+    }
+
+    bool readSymbol(SnapshotReader& reader, Symbol& value)
+    {
+        string name;
+        if (!reader.readString(name))
+            return false;
+        value = Symbol(name);
+        return true;
+    }
+
+    void writeSymbols(SnapshotWriter& writer, const vector<Symbol>& values)
+    {
+        writer.write(static_cast<std::uint32_t>(values.size()));
+        for (const auto& value : values)
+            writeSymbol(writer, value);
+    }
+
+    bool readSymbols(SnapshotReader& reader, vector<Symbol>& values)
+    {
+        std::uint32_t count = 0;
+        // każdy napis ma co najmniej 4 bajty długości - chroni przed uszkodzonym licznikiem
+        if (!reader.read(count) || count > reader.remaining() / sizeof(std::uint32_t))
+            return false;
+
+        values.resize(count);
+        for (auto& value : values)
+        {
+            if (!readSymbol(reader, value))
+                return false;
+        }
+        return true;
+    }
+}
+
+void ResearchManager::writeBinary(SnapshotWriter& writer) const
+{
+    writer.write(TECHNOLOGIES_CACHE_MAGIC);
+    writer.write(DATA_CACHE_VERSION);
+    writer.write(static_cast<std::uint32_t>(m_techs.size()));
+
+    for (const auto& tech : m_techs)
+    {
+        writeSymbol(writer, tech.m_id);
+        writer.writeString(tech.m_name);
+        writer.write(static_cast<std::uint8_t>(tech.m_type));
+        writer.write(tech.m_researchDays);
+        writer.write(tech.m_researchDaysMin);
+        writer.write(tech.m_researchDaysMax);
+        writer.write(tech.m_failureProbability);
+        writeSymbols(writer, tech.m_prerequisites);
+        writer.writeString(tech.m_description);
+        writer.write(tech.m_moneyCost);
+        writer.write(tech.m_daylyCost);
+        writer.write(tech.m_uraniumRequired);
+        writer.write(tech.m_plutoniumRequired);
+        writer.write(tech.m_workersRequired);
+        writer.write(tech.m_engineersRequired);
+        writer.write(tech.m_scientistsRequired);
+        writer.write(tech.m_armyPersonnelRequired);
+        writeSymbols(writer, tech.m_buildingRequired);
+        writeSymbols(writer, tech.m_charactersInvolved);
+    }
+}
+
+bool ResearchManager::readBinary(SnapshotReader& reader, vector<Technology>& techs)
+{
+    std::uint32_t magic = 0;
+    std::uint16_t version = 0;
+    std::uint32_t count = 0;
+    if (!reader.read(magic) || !reader.read(version) || !reader.read(count))
+        return false;
+
+    if (magic != TECHNOLOGIES_CACHE_MAGIC || version != DATA_CACHE_VERSION || count > reader.remaining())
+        return false;
+
+    techs.clear();
+    techs.resize(count);
+    for (auto& tech : techs)
+    {
+        std::uint8_t type = 0;
+        if (!readSymbol(reader, tech.m_id) || !reader.readString(tech.m_name) ||
+            !reader.read(type) || !reader.read(tech.m_researchDays) ||
+            !reader.read(tech.m_researchDaysMin) || !reader.read(tech.m_researchDaysMax) ||
+            !reader.read(tech.m_failureProbability) ||
+            !readSymbols(reader, tech.m_prerequisites) || !reader.readString(tech.m_description) ||
+            !reader.read(tech.m_moneyCost) || !reader.read(tech.m_daylyCost) ||
+            !reader.read(tech.m_uraniumRequired) || !reader.read(tech.m_plutoniumRequired) ||
+            !reader.read(tech.m_workersRequired) || !reader.read(tech.m_engineersRequired) ||
+            !reader.read(tech.m_scientistsRequired) || !reader.read(tech.m_armyPersonnelRequired) ||
+            !readSymbols(reader, tech.m_buildingRequired) || !readSymbols(reader, tech.m_charactersInvolved))
+            return false;
+
+        tech.m_type = static_cast<TechnologyType>(type);
+    }
+
+    return reader.atEnd();
+}
+
+void ResearchManager::loadFromJsonCached(const string& path)
+{
+    if (isBinaryCacheFresh(path))
+    {
+        MappedFile file(binaryCachePath(path));
+        SnapshotReader reader(file.bytes());
+        vector<Technology> techs;
+        if (file.isOpen() && readBinary(reader, techs))
+        {
+            loadTechnologies(move(techs));
+            return;
+        }
+    }
+
+    loadFromJson(path);
+
+    SnapshotWriter writer;
+    writeBinary(writer);
+    writeBinaryCache(path, writer.bytes());
+}
@@ -3,16 +3,24 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <cstdint>
 #include <functional>
+#include <random>
+#include <span>
 #include <unordered_map>
+#include "./../Core/header/Random.hpp"
+#include "./../Core/header/Symbol.hpp"
 #include "./../Core/header/TimeSystem.hpp"
 #include "./../Resources/ResourcesManager.hpp"
 
 
+class BudgetForecast;
+
 using std::enable_shared_from_this;
 using std::function;
 using std::optional;
 using std::shared_ptr;
+using std::span;
 using std::string;
 using std::unordered_map;
 using std::vector;
@@ -31,15 +39,40 @@ enum class ResearchState
     Completed
 };
 
+// Deterministic: badanie trwa dokładnie m_researchDays i zawsze się udaje.
+// Randomized: czas próby losowany z [min, max], próba może się nie udać
+// (postęp przepada, technologia wraca do Available).
+enum class ResearchOutcomeMode
+{
+    Deterministic,
+    Randomized,
+};
+
+// Górna granica szansy porażki - przy 1.0 oczekiwany czas byłby nieskończony.
+static const constexpr float MAX_FAILURE_PROBABILITY = 0.95f;
+
+
 
+// Indeks technologii w skompilowanym grafie (ResearchManager::getAllTechnologies()).
+using TechId = std::uint32_t;
+static const constexpr TechId INVALID_TECH_ID = ~TechId(0);
 
+// Identyfikatory (id, wymagania, budynki, postacie) są internowane przy wczytywaniu -
+// porównania to porównania uchwytów, napis tylko przez Symbol::str().
 struct Technology
 {
-    string m_id;
+    Symbol m_id;
+    // Pozycja w ResearchManager::getAllTechnologies(), nadawana przy kompilacji grafu.
+    TechId m_index = INVALID_TECH_ID;
     string m_name;
     TechnologyType m_type;
     unsigned short m_researchDays = 0;
-    vector<string> m_prerequisites;
+    // Rozkład czasu jednej próby (równomierny, w dniach) i szansa jej porażki.
+    // 0 w min/max = m_researchDays. Używane tylko w trybie Randomized.
+    unsigned short m_researchDaysMin = 0;
+    unsigned short m_researchDaysMax = 0;
+    float m_failureProbability = 0.f;
+    vector<Symbol> m_prerequisites;
     string m_description;
     unsigned m_moneyCost = 0;
     unsigned m_daylyCost = 0;
@@ -49,8 +82,8 @@ struct Technology
     unsigned m_engineersRequired = 0;
     unsigned m_scientistsRequired = 0;
     unsigned m_armyPersonnelRequired = 0;
-    vector<string> m_buildingRequired;
-    vector<string> m_charactersInvolved;
+    vector<Symbol> m_buildingRequired;
+    vector<Symbol> m_charactersInvolved;
 
     // dynamic state
     ResearchState m_state = ResearchState::Locked;
@@ -59,6 +92,50 @@ struct Technology
     inline bool isCompleted() const { return m_state == ResearchState::Completed; }
     inline bool isAvailable() const { return m_state == ResearchState::Available; }
     inline bool isInProgress() const { return m_state == ResearchState::InProgress; }
+    // Personel zajmowany przez badanie (układ jak PersonnelPool::RoleArray).
+    inline PersonnelPool::RoleArray requiredPersonnel() const
+    {
+        PersonnelPool::RoleArray personnel{};
+        personnel[roleIndex(PersonnelRole::Workers)] = m_workersRequired;
+        personnel[roleIndex(PersonnelRole::Scientists)] = m_scientistsRequired;
+        personnel[roleIndex(PersonnelRole::Engineers)] = m_engineersRequired;
+        personnel[roleIndex(PersonnelRole::ArmyPersonnel)] = m_armyPersonnelRequired;
+        return personnel;
+    }
+    inline unsigned short minResearchDays() const { return m_researchDaysMin ? m_researchDaysMin : m_researchDays; }
+    inline unsigned short maxResearchDays() const
+    {
+        const unsigned short max = m_researchDaysMax ? m_researchDaysMax : m_researchDays;
+        return max < minResearchDays() ? minResearchDays() : max;
+    }
+};
+
+// Czas (w dniach od teraz) do ukończenia technologii: wartość oczekiwana i wariancja.
+// m_reachable == false: wymaga nieistniejącej technologii albo leży na cyklu.
+struct ResearchEstimate
+{
+    double m_expectedDays = 0.0;
+    double m_variance = 0.0;
+    bool m_reachable = false;
+};
+
+// Badanie w toku - zwarty slot; onDaysPassed przechodzi tylko po tych slotach.
+struct ActiveResearch
+{
+    TechId m_techId = INVALID_TECH_ID;
+    unsigned m_progressDays = 0;
+    unsigned m_researchDays = 0;
+    // Personel zajęty przez to badanie (zwalniany po ukończeniu).
+    PersonnelPool::RoleArray m_assignedPersonnel{};
+};
+
+// Badanie czekające w kolejce na wolny personel.
+struct QueuedResearch
+{
+    TechId m_techId = INVALID_TECH_ID;
+    int m_priority = 0;
+    // Kolejność dodania - rozstrzyga remisy priorytetów (FIFO).
+    unsigned long m_sequence = 0;
 };
 
 class ResearchManager : public enable_shared_from_this<ResearchManager>
@@ -70,37 +147,169 @@ public:
     using ResearchMissingResourcesCallback =
         function<void(const ResourceMissing &)>;
 
+    using ResearchFailedCallback =
+        function<void(const Technology &)>;
+
+    // Zmiana stanu jednej technologii (start, ukończenie, porażka) albo
+    // INVALID_TECH_ID, gdy zmieniło się wszystko (wczytanie danych lub snapshotu).
+    using ResearchStateChangedCallback =
+        function<void(TechId)>;
+
     ResearchManager(TimeDataModel &timeModel, ResourcesManager &resources);
     ~ResearchManager() = default;
 
     void loadFromJson(const string &path);
+    // Jak loadFromJson, ale z binarnego cache "<path>.bin" (mmap), jeśli jest nowszy niż JSON.
+    // W przeciwnym razie parsuje JSON i zapisuje cache na następny start.
+    void loadFromJsonCached(const string &path);
+    // Wczytuje gotowe dane technologii (np. prototyp wczytany raz z JSON
+    // i współdzielony przez wiele światów). Stan dynamiczny jest resetowany.
+    void loadTechnologies(vector<Technology> techs);
+    // Statyczne dane technologii (bez stanu) w formacie cache.
+    void writeBinary(SnapshotWriter &writer) const;
+    static bool readBinary(SnapshotReader &reader, vector<Technology> &techs);
 
+    // Uruchamia badanie w nowym slocie. Wiele badań może trwać naraz - limitem
+    // jest personel: pracujący minus przydzielony do innych badań.
     bool startResearch(const string &techId);
+    bool startResearch(TechId techId);
+    // Dodaje badanie do kolejki priorytetowej (wyższy priorytet = wcześniej).
+    // Badanie startuje samo, gdy jest dostępne i zwolni się personel.
+    bool queueResearch(const string &techId, int priority = 0);
+    bool queueResearch(TechId techId, int priority = 0);
+    bool dequeueResearch(TechId techId);
+    const vector<QueuedResearch> &getResearchQueue() const { return m_researchQueue; }
+    // Zmienia się przy każdej zmianie kolejki (także ponownym dodaniu z innym priorytetem).
+    std::uint64_t getQueueVersion() const { return m_queueVersion; }
     void onDayPassed(const TimeDataModel &time);
+    // Przeskakuje od razu do kolejnych dni ukończenia zamiast liczyć dzień po dniu.
+    void onDaysPassed(const TimeDataModel &time, unsigned short firstDay, unsigned short count);
 
+    bool isCompleted(TechId techId) const;
+    bool isAvailable(TechId techId) const;
+    float getProgress(TechId techId) const;
+    // Postęp liczony względem czasu próby w slocie (w trybie losowym różni się od m_researchDays).
+    // Przeciążenia napisowe - dla skryptów i debugowania (lookup w tablicy symboli).
     bool isCompleted(const string &techId) const;
     bool isAvailable(const string &techId) const;
     float getProgress(const string &techId) const;
 
-    const unordered_map<string, Technology> &
-    getAllTechnologies() const { return m_techs; }
+    // Technologie w spójnej tablicy; indeks == Technology::m_index.
+    const vector<Technology> &getAllTechnologies() const { return m_techs; }
+    // Mapowanie id -> indeks: symbol to odczyt z tablicy, napis dodatkowo szuka
+    // w tablicy symboli (tylko na granicy API - skrypty, debug).
+    // (const char* osobno - literał pasowałby tak samo do Symbol, jak i do string).
+    optional<TechId> findTechnology(Symbol techId) const;
+    optional<TechId> findTechnology(const string &techId) const;
+    optional<TechId> findTechnology(const char *techId) const;
+    const Technology &getTechnology(TechId techId) const { return m_techs[techId]; }
+    // Rozwiązane wymagania (bez nieznanych id) i technologie zależne - listy CSR.
+    span<const TechId> getPrerequisites(TechId techId) const;
+    span<const TechId> getDependents(TechId techId) const;
+    // Pierwsze z trwających badań (nullptr gdy nic nie jest badane).
     const Technology *getActiveResearch() const;
+    const vector<ActiveResearch> &getActiveResearches() const { return m_activeSlots; }
+    // Slot trwającego badania (z wylosowanym czasem próby) albo nullptr.
+    const ActiveResearch *getActiveSlot(TechId techId) const;
+    // Personel przydzielony do wszystkich trwających badań.
+    const PersonnelPool::RoleArray &getAssignedPersonnel() const { return m_assignedPersonnel; }
+    // Dni do najbliższego ukończenia badania albo nullopt, gdy nic nie jest badane.
+    optional<unsigned short> daysUntilNextCompletion() const;
+    // Suma Technology::m_daylyCost trwających badań (naliczana przez ResourcesManager).
+    long activeResearchDailyCost() const;
+    // Zgłasza prognozie koniec kosztu dziennego każdego trwającego badania -
+    // koszt obowiązuje do dnia ukończenia włącznie.
+    void addResearchCosts(BudgetForecast &forecast) const;
+
+    // Stan dynamiczny: stan i postęp każdej technologii, sloty i kolejka.
+    // Snapshot pasuje tylko do tych samych danych technologii (sprawdzany skrót id);
+    // readSnapshot nie zmienia stanu przy błędnych danych.
+    void writeSnapshot(SnapshotWriter &writer) const;
+    bool readSnapshot(SnapshotReader &reader);
+    // FNV-1a po id technologii w kolejności indeksów (zgodność snapshotów i logów).
+    std::uint64_t technologySetHash() const;
+
+    // Tryb losowy używa własnego generatora (zapisywanego w snapshocie), więc
+    // powtórka logu komend daje te same czasy i porażki.
+    void setOutcomeMode(ResearchOutcomeMode mode, std::uint64_t seed = 0);
+    ResearchOutcomeMode getOutcomeMode() const { return m_outcomeMode; }
+
+    // Analityczne ETA (bez Monte Carlo) - jedno przejście DP po grafie w kolejności
+    // topologicznej, O(V + E). Liczy od bieżącego stanu i zakłada: każde badanie
+    // startuje, gdy skończą się jego wymagania (bez limitu slotów), a porażka jest
+    // od razu powtarzana. Czas technologii = max(ukończenie wymagań) + czas prób;
+    // max zmiennych losowych przybliżony metodą Clarka (momenty, niezależność).
+    ResearchEstimate estimateCompletion(TechId techId) const;
+    vector<ResearchEstimate> estimateAllCompletions() const;
+    // Kolejność topologiczna (bez technologii leżących na cyklach).
+    const vector<TechId> &getTopologicalOrder() const { return m_topologicalOrder; }
+    // Zmienia się przy każdej kompilacji grafu (wczytanie technologii) - cache układu drzewa.
+    std::uint64_t getGraphVersion() const { return m_graphVersion; }
 
     void addResearchCompletedListener(ResearchCompletedCallback cb);
     void addResearchMissingResourcesListener(ResearchMissingResourcesCallback cb);
+    void addResearchFailedListener(ResearchFailedCallback cb);
+    // Subskrypcja dla widoków pochodnych (cache planów, layout drzewa) - uchwyt RAII,
+    // więc subskrybent może zniknąć przed managerem.
+    [[nodiscard]] ObserverSubscription subscribeStateChanged(ResearchStateChangedCallback cb) const;
 
 private:
+    // Dopisuje m_techs[techId] do m_techBySymbol.
+    void indexTechnology(TechId techId);
+    // Buduje indeksy i listy sąsiedztwa (CSR) z m_techs.
+    void compileGraph();
+    // Pełne przeliczenie liczników i dostępności (po wczytaniu danych).
     void updateAvailability();
+    // Po ukończeniu technologii zmniejsza liczniki tylko jej zależnych - O(stopień wyjściowy).
+    void updateAvailabilityOfDependents(TechId completed);
     void calculateResearchTime(Technology &tech);
+    ResourceMissing checkMissingResources(const Technology &tech) const;
+    void beginResearch(Technology &tech);
+    // Koniec próby: w trybie losowym najpierw rzut na porażkę.
+    void finishResearch(TechId techId);
+    void completeResearch(TechId techId);
+    void failResearch(TechId techId);
+    // Zwalnia slot i jego personel.
+    void releaseSlot(TechId techId);
+    // Przekazuje koszt dzienny trwających badań do ResourcesManager.
+    void syncResearchCost();
+    unsigned sampleResearchDays(const Technology &tech);
+    // Uruchamia z kolejki wszystko, na co starcza zasobów (bez zdarzeń o brakach).
+    void startQueuedResearch();
 
 private:
     TimeDataModel &m_timeModel;
     ResourcesManager &m_resources;
-    unordered_map<string, Technology> m_techs;
-    shared_ptr<TimeDataModel::DayPassedCallback> m_dayObserverHandle;
+    vector<Technology> m_techs;
+    // Symbol::value() -> indeks technologii (INVALID_TECH_ID dla innych symboli).
+    vector<TechId> m_techBySymbol;
+    // CSR: wymagania technologii i leżą w m_prerequisiteIds[m_prerequisiteOffsets[i] .. m_prerequisiteOffsets[i + 1])
+    vector<unsigned> m_prerequisiteOffsets;
+    vector<TechId> m_prerequisiteIds;
+    vector<unsigned> m_dependentOffsets;
+    vector<TechId> m_dependentIds;
+    // Liczba wymagań wskazujących na nieistniejące id - taka technologia nigdy nie będzie dostępna.
+    vector<unsigned> m_unresolvedPrerequisites;
+    // Ile wymagań jeszcze nie ukończono (łącznie z nierozwiązanymi). 0 -> technologia dostępna.
+    vector<unsigned> m_remainingPrerequisites;
+    vector<TechId> m_topologicalOrder;
+    std::uint64_t m_graphVersion = 0;
+    ObserverSubscription m_daysSubscription;
+    ObserverSubscription m_batchLimitSubscription;
+
+    vector<ActiveResearch> m_activeSlots;
+    PersonnelPool::RoleArray m_assignedPersonnel{};
+    // Posortowana: priorytet malejąco, potem kolejność dodania.
+    vector<QueuedResearch> m_researchQueue;
+    unsigned long m_queueSequence = 0;
+    std::uint64_t m_queueVersion = 0;
 
-    optional<string> m_activeResearchId;
+    ResearchOutcomeMode m_outcomeMode = ResearchOutcomeMode::Deterministic;
+    Xoshiro256 m_outcomeRng;
 
     vector<ResearchCompletedCallback> m_researchCompletedListeners;
     vector<ResearchMissingResourcesCallback> m_missingResourcesListeners;
+    vector<ResearchFailedCallback> m_researchFailedListeners;
+    shared_ptr<ObserverRegistry<ResearchStateChangedCallback>> m_stateObservers =
+        std::make_shared<ObserverRegistry<ResearchStateChangedCallback>>();
 };
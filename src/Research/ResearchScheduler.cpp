@@ -0,0 +1,431 @@
+#include "ResearchScheduler.hpp"
+#include "../Resources/BudgetForecast.hpp"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <queue>
+#include <utility>
+
+using std::greater;
+using std::max;
+using std::pair;
+using std::priority_queue;
+
+namespace
+{
+    // badanie 0-dniowe też zajmuje 1 dzień (jak w ResearchManager::onDaysPassed)
+    unsigned durationOf(const Technology &tech)
+    {
+        return max<unsigned>(tech.m_researchDays, 1u);
+    }
+
+    unsigned remainingOf(const ActiveResearch &slot)
+    {
+        return slot.m_researchDays > slot.m_progressDays ? slot.m_researchDays - slot.m_progressDays : 1u;
+    }
+}
+
+ResearchScheduler::ResearchScheduler(const TimeDataModel &timeModel, const ResearchManager &research,
+                                     const ResourcesManager &resources)
+    : m_timeModel(timeModel), m_research(research), m_resources(resources)
+{
+    m_stateSubscription = m_research.subscribeStateChanged(
+        [this](TechId techId) { markDirty(techId); });
+}
+
+void ResearchScheduler::markDirty(TechId techId)
+{
+    if (techId == INVALID_TECH_ID || techId >= m_isDirty.size())
+    {
+        m_needsRebuild = true;
+        return;
+    }
+
+    if (m_needsRebuild || m_isDirty[techId])
+        return;
+
+    m_isDirty[techId] = 1;
+    m_dirty.push_back(techId);
+}
+
+void ResearchScheduler::rebuild()
+{
+    const size_t count = m_research.getAllTechnologies().size();
+    const unsigned today = m_timeModel.currentGameDay();
+
+    m_fromToday.assign(count, NO_PATH);
+    m_fromRunning.assign(count, NO_PATH);
+    m_reachable.assign(count, 0);
+    m_topologicalRank.assign(count, UINT_MAX);
+    m_isDirty.assign(count, 0);
+    m_dirty.clear();
+
+    const auto &order = m_research.getTopologicalOrder();
+    for (unsigned rank = 0; rank < order.size(); ++rank)
+    {
+        m_topologicalRank[order[rank]] = rank;
+        recompute(order[rank], today);
+    }
+
+    m_lastRecomputed = order.size();
+    m_needsRebuild = false;
+}
+
+void ResearchScheduler::refresh()
+{
+    if (m_needsRebuild)
+    {
+        rebuild();
+        return;
+    }
+
+    m_lastRecomputed = 0;
+    if (m_dirty.empty())
+        return;
+
+    const unsigned today = m_timeModel.currentGameDay();
+
+    // kolejność topologiczna gwarantuje, że wymagania są policzone przed zależnymi
+    priority_queue<pair<unsigned, TechId>, vector<pair<unsigned, TechId>>, greater<>> pending;
+    for (TechId techId : m_dirty)
+    {
+        if (m_topologicalRank[techId] != UINT_MAX)
+            pending.emplace(m_topologicalRank[techId], techId);
+        else
+            m_isDirty[techId] = 0;
+    }
+    m_dirty.clear();
+
+    while (!pending.empty())
+    {
+        const TechId techId = pending.top().second;
+        pending.pop();
+        m_isDirty[techId] = 0;
+        m_lastRecomputed++;
+
+        // wynik bez zmian -> zależni też się nie zmienią
+        if (!recompute(techId, today))
+            continue;
+
+        for (TechId dependent : m_research.getDependents(techId))
+        {
+            if (m_isDirty[dependent] || m_topologicalRank[dependent] == UINT_MAX)
+                continue;
+            m_isDirty[dependent] = 1;
+            pending.emplace(m_topologicalRank[dependent], dependent);
+        }
+    }
+}
+
+bool ResearchScheduler::recompute(TechId techId, unsigned today)
+{
+    const Technology &tech = m_research.getTechnology(techId);
+    long long fromToday = NO_PATH;
+    long long fromRunning = NO_PATH;
+    bool reachable = true;
+
+    if (tech.isInProgress())
+    {
+        // dzień ukończenia trwającego badania nie zmienia się z upływem dni
+        const auto &slots = m_research.getActiveResearches();
+        auto slot = std::find_if(slots.begin(), slots.end(),
+                                 [&](const ActiveResearch &s) { return s.m_techId == techId; });
+        fromRunning = static_cast<long long>(today) + (slot != slots.end() ? remainingOf(*slot) : 1u);
+    }
+    else if (!tech.isCompleted())
+    {
+        // nierozwiązane wymagania (nieistniejące id) nie trafiają do listy CSR
+        reachable = m_research.getPrerequisites(techId).size() == tech.m_prerequisites.size();
+        fromToday = 0;
+
+        for (TechId pre : m_research.getPrerequisites(techId))
+        {
+            if (!reachable || !m_reachable[pre])
+            {
+                reachable = false;
+                break;
+            }
+            fromToday = max(fromToday, m_fromToday[pre]);
+            fromRunning = max(fromRunning, m_fromRunning[pre]);
+        }
+
+        if (reachable)
+        {
+            fromToday += durationOf(tech);
+            if (fromRunning != NO_PATH)
+                fromRunning += durationOf(tech);
+        }
+        else
+        {
+            fromToday = NO_PATH;
+            fromRunning = NO_PATH;
+        }
+    }
+
+    const bool changed = m_fromToday[techId] != fromToday || m_fromRunning[techId] != fromRunning ||
+                         m_reachable[techId] != static_cast<unsigned char>(reachable);
+
+    m_fromToday[techId] = fromToday;
+    m_fromRunning[techId] = fromRunning;
+    m_reachable[techId] = reachable;
+    return changed;
+}
+
+long long ResearchScheduler::finishDay(TechId techId, unsigned today) const
+{
+    long long finish = today;
+    if (m_fromToday[techId] != NO_PATH)
+        finish = max(finish, static_cast<long long>(today) + m_fromToday[techId]);
+    if (m_fromRunning[techId] != NO_PATH)
+        finish = max(finish, m_fromRunning[techId]);
+    return finish;
+}
+
+TechTiming ResearchScheduler::timing(TechId techId)
+{
+    refresh();
+    if (techId >= m_reachable.size() || !m_reachable[techId])
+        return {};
+
+    const unsigned today = m_timeModel.currentGameDay();
+    const Technology &tech = m_research.getTechnology(techId);
+    const auto finish = static_cast<unsigned>(finishDay(techId, today));
+
+    if (tech.isCompleted() || tech.isInProgress())
+        return {today, finish, true};
+
+    return {finish - durationOf(tech), finish, true};
+}
+
+vector<TechId> ResearchScheduler::criticalPath(TechId techId)
+{
+    refresh();
+    vector<TechId> path;
+    if (techId >= m_reachable.size() || !m_reachable[techId] || m_research.getTechnology(techId).isCompleted())
+        return path;
+
+    const unsigned today = m_timeModel.currentGameDay();
+    TechId current = techId;
+    while (true)
+    {
+        path.push_back(current);
+        if (m_research.getTechnology(current).isInProgress())
+            break;
+
+        // wymaganie kończące się najpóźniej wyznacza start; jeśli nie później niż dziś - koniec ścieżki
+        TechId latest = INVALID_TECH_ID;
+        long long latestFinish = today;
+        for (TechId pre : m_research.getPrerequisites(current))
+        {
+            const long long finish = finishDay(pre, today);
+            if (finish > latestFinish)
+            {
+                latest = pre;
+                latestFinish = finish;
+            }
+        }
+
+        if (latest == INVALID_TECH_ID)
+            break;
+        current = latest;
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+SchedulerLimits ResearchScheduler::currentLimits() const
+{
+    SchedulerLimits limits;
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+        limits.m_personnel[i] = m_resources.getWorking(static_cast<PersonnelRole>(i));
+    return limits;
+}
+
+void ResearchScheduler::addPlannedCosts(BudgetForecast &forecast, const ResearchSchedule &schedule) const
+{
+    const unsigned today = m_timeModel.currentGameDay();
+    for (const auto &entry : schedule.m_entries)
+    {
+        const Technology &tech = m_research.getTechnology(entry.m_techId);
+        if (tech.isInProgress() || entry.m_startDay < today)
+            continue;
+
+        // start w dniu S: koszt jednorazowy przed rozliczeniem dnia S + 1, dzienny w (S, koniec]
+        const unsigned firstDay = entry.m_startDay - today + 1;
+        const unsigned lastDay = entry.m_finishDay - today;
+        if (firstDay > USHRT_MAX)
+            continue;
+        forecast.addExpense(static_cast<unsigned short>(firstDay), tech.m_moneyCost);
+        forecast.addCostInterval(static_cast<unsigned short>(firstDay),
+                                 static_cast<unsigned short>(std::min<unsigned>(lastDay, USHRT_MAX)), tech.m_daylyCost);
+    }
+}
+
+ResearchSchedule ResearchScheduler::planSchedule(TechId techId)
+{
+    return planSchedule(techId, currentLimits());
+}
+
+ResearchSchedule ResearchScheduler::planSchedule(TechId techId, const SchedulerLimits &limits)
+{
+    refresh();
+
+    const auto &techs = m_research.getAllTechnologies();
+    const size_t count = techs.size();
+    const unsigned today = m_timeModel.currentGameDay();
+    ResearchSchedule schedule;
+    schedule.m_finishDay = today;
+
+    if (techId != INVALID_TECH_ID && (techId >= count || !m_reachable[techId]))
+    {
+        schedule.m_feasible = false;
+        return schedule;
+    }
+
+    // 1) co trzeba zbadać: przodkowie celu (albo wszystko osiągalne), bez ukończonych
+    vector<unsigned char> relevant(count, 0);
+    if (techId == INVALID_TECH_ID)
+    {
+        for (TechId i = 0; i < count; ++i)
+            relevant[i] = m_reachable[i] && !techs[i].isCompleted();
+    }
+    else
+    {
+        vector<TechId> stack{techId};
+        while (!stack.empty())
+        {
+            const TechId current = stack.back();
+            stack.pop_back();
+            if (relevant[current] || techs[current].isCompleted())
+                continue;
+            relevant[current] = 1;
+            for (TechId pre : m_research.getPrerequisites(current))
+                stack.push_back(pre);
+        }
+    }
+
+    // 2) priorytet: najdłuższy ogon do końca planu (odwrócona kolejność topologiczna)
+    const auto &order = m_research.getTopologicalOrder();
+    vector<unsigned> tail(count, 0);
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        if (!relevant[*it])
+            continue;
+        unsigned longest = 0;
+        for (TechId dependent : m_research.getDependents(*it))
+        {
+            if (relevant[dependent])
+                longest = max(longest, tail[dependent]);
+        }
+        tail[*it] = durationOf(techs[*it]) + longest;
+    }
+
+    vector<unsigned> remaining(count, 0);
+    vector<TechId> ready;
+    for (TechId i = 0; i < count; ++i)
+    {
+        if (!relevant[i] || techs[i].isInProgress())
+            continue;
+        for (TechId pre : m_research.getPrerequisites(i))
+        {
+            if (relevant[pre])
+                remaining[i]++;
+        }
+        if (remaining[i] == 0)
+            ready.push_back(i);
+    }
+
+    // 3) symulacja zdarzeń: trwające badania zajmują personel i sloty do końca
+    PersonnelPool::RoleArray freePersonnel = limits.m_personnel;
+    unsigned usedSlots = 0;
+    priority_queue<pair<unsigned, TechId>, vector<pair<unsigned, TechId>>, greater<>> running;
+
+    auto take = [&](const PersonnelPool::RoleArray &personnel)
+    {
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+            freePersonnel[i] -= std::min(freePersonnel[i], personnel[i]);
+    };
+    auto fits = [&](const PersonnelPool::RoleArray &personnel)
+    {
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+        {
+            if (personnel[i] > freePersonnel[i])
+                return false;
+        }
+        return true;
+    };
+
+    for (const auto &slot : m_research.getActiveResearches())
+    {
+        const unsigned finish = today + remainingOf(slot);
+        take(slot.m_assignedPersonnel);
+        usedSlots++;
+        running.emplace(finish, slot.m_techId);
+        if (relevant[slot.m_techId])
+            schedule.m_entries.push_back({slot.m_techId, today, finish});
+    }
+
+    unsigned now = today;
+    bool targetDone = techId != INVALID_TECH_ID && techs[techId].isCompleted();
+    while (!targetDone)
+    {
+        std::sort(ready.begin(), ready.end(), [&](TechId a, TechId b)
+                  { return tail[a] != tail[b] ? tail[a] > tail[b] : a < b; });
+
+        vector<TechId> waiting;
+        for (TechId candidate : ready)
+        {
+            const auto personnel = techs[candidate].requiredPersonnel();
+            if (usedSlots < limits.m_maxConcurrentResearch && fits(personnel))
+            {
+                take(personnel);
+                usedSlots++;
+                const unsigned finish = now + durationOf(techs[candidate]);
+                running.emplace(finish, candidate);
+                schedule.m_entries.push_back({candidate, now, finish});
+            }
+            else
+            {
+                waiting.push_back(candidate);
+            }
+        }
+        ready = std::move(waiting);
+
+        if (running.empty())
+        {
+            // zostały badania, które nigdy nie zmieszczą się w limitach
+            schedule.m_feasible = ready.empty() && techId == INVALID_TECH_ID;
+            break;
+        }
+
+        now = running.top().first;
+        while (!running.empty() && running.top().first == now)
+        {
+            const TechId finished = running.top().second;
+            running.pop();
+            usedSlots--;
+
+            const auto &slots = m_research.getActiveResearches();
+            auto slot = std::find_if(slots.begin(), slots.end(),
+                                     [&](const ActiveResearch &s) { return s.m_techId == finished; });
+            const auto personnel = slot != slots.end() ? slot->m_assignedPersonnel : techs[finished].requiredPersonnel();
+            for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+                freePersonnel[i] = std::min(freePersonnel[i] + personnel[i], limits.m_personnel[i]);
+
+            schedule.m_finishDay = max(schedule.m_finishDay, now);
+            if (finished == techId)
+                targetDone = true;
+
+            if (!relevant[finished])
+                continue;
+            for (TechId dependent : m_research.getDependents(finished))
+            {
+                if (relevant[dependent] && --remaining[dependent] == 0)
+                    ready.push_back(dependent);
+            }
+        }
+    }
+
+    return schedule;
+}
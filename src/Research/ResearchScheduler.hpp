@@ -0,0 +1,102 @@
+#pragma once
+#include <climits>
+#include <vector>
+#include "ResearchManager.hpp"
+
+using std::vector;
+
+// Terminy jednej technologii w dniach gry (bez limitu slotów i personelu).
+struct TechTiming
+{
+    unsigned m_earliestStart = 0;
+    unsigned m_earliestFinish = 0;
+    bool m_reachable = false;
+};
+
+// Limity planu: sloty badań i personel dostępny dla badań.
+struct SchedulerLimits
+{
+    unsigned m_maxConcurrentResearch = UINT_MAX;
+    PersonnelPool::RoleArray m_personnel{};
+};
+
+struct ScheduledResearch
+{
+    TechId m_techId = INVALID_TECH_ID;
+    unsigned m_startDay = 0;
+    unsigned m_finishDay = 0;
+};
+
+// Plan z uwzględnieniem limitów; m_feasible == false, gdy czegoś nie da się
+// zmieścić w limitach (np. badanie wymaga więcej personelu niż jest) albo jest nieosiągalne.
+struct ResearchSchedule
+{
+    vector<ScheduledResearch> m_entries;
+    unsigned m_finishDay = 0;
+    bool m_feasible = true;
+};
+
+// Ścieżka krytyczna i najkrótszy plan badań nad grafem ResearchManager.
+//
+// Najwcześniejsze terminy (CPM) są liczone DP w kolejności topologicznej i trzymane
+// w cache w postaci niezależnej od bieżącego dnia: ukończenie = max(dziś + A, B),
+// gdzie A to najdłuższa ścieżka od "teraz", a B - od trwających badań (dzień bezwzględny).
+// Upływ dni nie unieważnia więc cache; zmiana stanu technologii oznacza ją jako brudną,
+// a przy następnym zapytaniu przeliczane są tylko ona i te zależne, których wynik się zmienił.
+class ResearchScheduler
+{
+public:
+    ResearchScheduler(const TimeDataModel &timeModel, const ResearchManager &research, const ResourcesManager &resources);
+    ~ResearchScheduler() = default;
+
+    ResearchScheduler(const ResearchScheduler &) = delete;
+    ResearchScheduler &operator=(const ResearchScheduler &) = delete;
+
+    // Najwcześniejszy start/koniec przy nieograniczonych slotach i personelu.
+    TechTiming timing(TechId techId);
+    // Technologie od pierwszej do techId, z których każda opóźnia następną (puste, gdy nieosiągalna).
+    vector<TechId> criticalPath(TechId techId);
+
+    // Najkrótszy plan dojścia do techId (INVALID_TECH_ID = wszystkie technologie)
+    // przy limitach slotów i personelu. Szeregowanie listowe: gotowe badanie
+    // z najdłuższym ogonem do celu startuje pierwsze. Koszty pieniężne są pomijane.
+    ResearchSchedule planSchedule(TechId techId, const SchedulerLimits &limits);
+    // Jak wyżej, limity personelu = obecnie pracujący w ResourcesManager.
+    ResearchSchedule planSchedule(TechId techId);
+    SchedulerLimits currentLimits() const;
+    // Dopisuje do prognozy koszty zaplanowanych (jeszcze nie rozpoczętych) badań:
+    // koszt jednorazowy w dniu startu i koszt dzienny do ukończenia. Trwające badania
+    // zgłasza ResearchManager::addResearchCosts.
+    void addPlannedCosts(BudgetForecast &forecast, const ResearchSchedule &schedule) const;
+
+    // Ile technologii przeliczyło ostatnie odświeżenie cache (diagnostyka/testy).
+    size_t lastRecomputedCount() const { return m_lastRecomputed; }
+
+private:
+    // Przelicza brudne technologie i propaguje zmiany do zależnych.
+    void refresh();
+    void rebuild();
+    // Zwraca true, gdy wynik technologii się zmienił.
+    bool recompute(TechId techId, unsigned today);
+    long long finishDay(TechId techId, unsigned today) const;
+    void markDirty(TechId techId);
+
+private:
+    const TimeDataModel &m_timeModel;
+    const ResearchManager &m_research;
+    const ResourcesManager &m_resources;
+    ObserverSubscription m_stateSubscription;
+
+    // Długości w dniach; NO_PATH = brak takiego źródła.
+    static const constexpr long long NO_PATH = LLONG_MIN / 4;
+    vector<long long> m_fromToday;
+    vector<long long> m_fromRunning;
+    vector<unsigned char> m_reachable;
+    // Pozycja w kolejności topologicznej (UINT_MAX = technologia na cyklu).
+    vector<unsigned> m_topologicalRank;
+
+    vector<TechId> m_dirty;
+    vector<unsigned char> m_isDirty;
+    bool m_needsRebuild = true;
+    size_t m_lastRecomputed = 0;
+};
@@ -0,0 +1,349 @@
+#include "TechTreeLayout.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+using std::max;
+using std::min;
+
+void TechTreeLayout::build(const ResearchManager &research)
+{
+    const size_t count = research.getAllTechnologies().size();
+
+    m_nodes.assign(count, TechNodeLayout{});
+    m_edges.clear();
+    m_edges.reserve(count);
+    for (TechId i = 0; i < count; ++i)
+    {
+        for (TechId pre : research.getPrerequisites(i))
+            m_edges.push_back({pre, i});
+    }
+
+    vector<vector<TechId>> layers;
+    assignLayers(research, layers);
+    orderLayers(research, layers);
+    placeNodes(layers);
+    buildGrid();
+
+    m_nodeStamps.assign(count, 0);
+    m_edgeStamps.assign(m_edges.size(), 0);
+    m_queryStamp = 0;
+}
+
+// =====================================================
+// LAYOUT
+// =====================================================
+void TechTreeLayout::assignLayers(const ResearchManager &research, vector<vector<TechId>> &layers)
+{
+    const size_t count = m_nodes.size();
+    const auto &order = research.getTopologicalOrder();
+
+    // najdłuższa ścieżka od korzenia - wymagania zawsze w warstwach po lewej
+    vector<unsigned> layerOf(count, UINT_MAX);
+    unsigned maxLayer = 0;
+    for (TechId techId : order)
+    {
+        unsigned layer = 0;
+        for (TechId pre : research.getPrerequisites(techId))
+            layer = max(layer, layerOf[pre] + 1);
+
+        layerOf[techId] = layer;
+        maxLayer = max(maxLayer, layer);
+    }
+
+    // technologie na cyklach (błędne dane) lądują w osobnej, ostatniej warstwie
+    const bool hasCycles = order.size() < count;
+    const unsigned cycleLayer = order.empty() ? 0 : maxLayer + 1;
+
+    m_layerCount = count == 0 ? 0 : (hasCycles ? cycleLayer + 1 : maxLayer + 1);
+    layers.assign(m_layerCount, {});
+
+    for (TechId techId : order)
+        layers[layerOf[techId]].push_back(techId);
+
+    if (hasCycles)
+    {
+        for (TechId i = 0; i < count; ++i)
+        {
+            if (layerOf[i] != UINT_MAX)
+                continue;
+            layerOf[i] = cycleLayer;
+            layers[cycleLayer].push_back(i);
+        }
+    }
+
+    for (TechId i = 0; i < count; ++i)
+        m_nodes[i].m_layer = layerOf[i];
+}
+
+void TechTreeLayout::orderLayers(const ResearchManager &research, vector<vector<TechId>> &layers)
+{
+    const size_t count = m_nodes.size();
+
+    // pozycja względem środka warstwy - warstwy są centrowane pionowo
+    vector<float> position(count, 0.f);
+    vector<float> key(count, 0.f);
+
+    auto renumber = [&](const vector<TechId> &layer)
+    {
+        const float middle = (static_cast<float>(layer.size()) - 1.f) * 0.5f;
+        for (size_t i = 0; i < layer.size(); ++i)
+            position[layer[i]] = static_cast<float>(i) - middle;
+    };
+
+    // barycentrum sąsiadów z warstwy obok; bez sąsiadów węzeł zostaje na miejscu
+    auto sweep = [&](vector<TechId> &layer, auto neighboursOf)
+    {
+        for (TechId techId : layer)
+        {
+            float sum = 0.f;
+            unsigned n = 0;
+            for (TechId other : neighboursOf(techId))
+            {
+                sum += position[other];
+                n++;
+            }
+            key[techId] = n ? sum / static_cast<float>(n) : position[techId];
+        }
+
+        std::stable_sort(layer.begin(), layer.end(),
+                         [&](TechId a, TechId b) { return key[a] < key[b]; });
+        renumber(layer);
+    };
+
+    for (const auto &layer : layers)
+        renumber(layer);
+
+    auto prerequisites = [&](TechId techId) { return research.getPrerequisites(techId); };
+    auto dependents = [&](TechId techId) { return research.getDependents(techId); };
+
+    for (unsigned pass = 0; pass < ORDERING_SWEEPS; ++pass)
+    {
+        for (size_t l = 1; l < layers.size(); ++l)
+            sweep(layers[l], prerequisites);
+        for (size_t l = layers.size(); l-- > 1;)
+            sweep(layers[l - 1], dependents);
+    }
+}
+
+void TechTreeLayout::placeNodes(const vector<vector<TechId>> &layers)
+{
+    size_t maxRows = 0;
+    for (const auto &layer : layers)
+        maxRows = max(maxRows, layer.size());
+
+    const float pitchX = NODE_WIDTH + LAYER_GAP;
+    const float pitchY = NODE_HEIGHT + ROW_GAP;
+
+    for (size_t l = 0; l < layers.size(); ++l)
+    {
+        const float offset = static_cast<float>(maxRows - layers[l].size()) * pitchY * 0.5f;
+        for (size_t row = 0; row < layers[l].size(); ++row)
+        {
+            TechNodeLayout &node = m_nodes[layers[l][row]];
+            node.m_x = static_cast<float>(l) * pitchX;
+            node.m_y = offset + static_cast<float>(row) * pitchY;
+        }
+    }
+
+    m_bounds = LayoutRect{};
+    if (!layers.empty())
+    {
+        m_bounds.m_maxX = static_cast<float>(layers.size()) * pitchX - LAYER_GAP;
+        m_bounds.m_maxY = static_cast<float>(maxRows) * pitchY - ROW_GAP;
+    }
+}
+
+LayoutRect TechTreeLayout::nodeRect(TechId techId) const
+{
+    const TechNodeLayout &node = m_nodes[techId];
+    return {node.m_x, node.m_y, node.m_x + NODE_WIDTH, node.m_y + NODE_HEIGHT};
+}
+
+LayoutRect TechTreeLayout::edgeRect(const TechEdgeLayout &edge) const
+{
+    // od prawej krawędzi wymagania do lewej krawędzi zależnej, w połowie wysokości
+    const TechNodeLayout &from = m_nodes[edge.m_from];
+    const TechNodeLayout &to = m_nodes[edge.m_to];
+    const float fromX = from.m_x + NODE_WIDTH;
+    const float fromY = from.m_y + NODE_HEIGHT * 0.5f;
+    const float toY = to.m_y + NODE_HEIGHT * 0.5f;
+    return {min(fromX, to.m_x), min(fromY, toY), max(fromX, to.m_x), max(fromY, toY)};
+}
+
+LayoutPoint TechTreeLayout::edgePoint(const TechEdgeLayout &edge, float t) const
+{
+    const TechNodeLayout &from = m_nodes[edge.m_from];
+    const TechNodeLayout &to = m_nodes[edge.m_to];
+    const float x0 = from.m_x + NODE_WIDTH;
+    const float y0 = from.m_y + NODE_HEIGHT * 0.5f;
+    const float x3 = to.m_x;
+    const float y3 = to.m_y + NODE_HEIGHT * 0.5f;
+    const float dx = (x3 - x0) * 0.5f;
+
+    // Bezier (x0, y0) (x0 + dx, y0) (x3 - dx, y3) (x3, y3)
+    const float u = 1.f - t;
+    const float b0 = u * u * u;
+    const float b1 = 3.f * u * u * t;
+    const float b2 = 3.f * u * t * t;
+    const float b3 = t * t * t;
+    return {b0 * x0 + b1 * (x0 + dx) + b2 * (x3 - dx) + b3 * x3,
+            (b0 + b1) * y0 + (b2 + b3) * y3};
+}
+
+// =====================================================
+// SPATIAL INDEX
+// =====================================================
+template <typename Fn>
+void TechTreeLayout::forEachCell(const LayoutRect &rect, Fn &&fn) const
+{
+    if (m_cellsX == 0 || !rect.intersects(m_bounds))
+        return;
+
+    auto cellOf = [](float value, float origin, unsigned cells)
+    {
+        const float cell = std::floor((value - origin) / CELL_SIZE);
+        return static_cast<unsigned>(std::clamp(cell, 0.f, static_cast<float>(cells - 1)));
+    };
+
+    const unsigned x0 = cellOf(rect.m_minX, m_bounds.m_minX, m_cellsX);
+    const unsigned x1 = cellOf(rect.m_maxX, m_bounds.m_minX, m_cellsX);
+    const unsigned y0 = cellOf(rect.m_minY, m_bounds.m_minY, m_cellsY);
+    const unsigned y1 = cellOf(rect.m_maxY, m_bounds.m_minY, m_cellsY);
+
+    for (unsigned y = y0; y <= y1; ++y)
+    {
+        for (unsigned x = x0; x <= x1; ++x)
+            fn(y * m_cellsX + x);
+    }
+}
+
+void TechTreeLayout::edgeCells(const TechEdgeLayout &edge, vector<unsigned> &cells) const
+{
+    cells.clear();
+
+    // łamana z odcinków krótszych niż pół komórki; prostokąt odcinka z małym marginesem
+    // pokrywa wygięcie krzywej między próbkami
+    const LayoutRect rect = edgeRect(edge);
+    const float span = (rect.m_maxX - rect.m_minX) + (rect.m_maxY - rect.m_minY);
+    const unsigned segments = 1 + static_cast<unsigned>(span / (CELL_SIZE * 0.5f));
+    const float margin = 2.f;
+
+    LayoutPoint previous = edgePoint(edge, 0.f);
+    for (unsigned s = 1; s <= segments; ++s)
+    {
+        const LayoutPoint next = edgePoint(edge, static_cast<float>(s) / static_cast<float>(segments));
+        const LayoutRect segment{min(previous.m_x, next.m_x) - margin, min(previous.m_y, next.m_y) - margin,
+                                 max(previous.m_x, next.m_x) + margin, max(previous.m_y, next.m_y) + margin};
+        forEachCell(segment, [&](unsigned cell) { cells.push_back(cell); });
+        previous = next;
+    }
+
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+}
+
+void TechTreeLayout::buildGrid()
+{
+    if (m_nodes.empty())
+    {
+        m_cellsX = m_cellsY = 0;
+        m_nodeCellOffsets.assign(1, 0);
+        m_nodeCellItems.clear();
+        m_edgeCellOffsets.assign(1, 0);
+        m_edgeCellItems.clear();
+        return;
+    }
+
+    auto cellsAlong = [](float extent)
+    {
+        return max(1u, static_cast<unsigned>(std::ceil(extent / CELL_SIZE)));
+    };
+    m_cellsX = cellsAlong(m_bounds.m_maxX - m_bounds.m_minX);
+    m_cellsY = cellsAlong(m_bounds.m_maxY - m_bounds.m_minY);
+    const size_t cells = static_cast<size_t>(m_cellsX) * m_cellsY;
+
+    // CSR w dwóch przejściach: zliczenie, potem wypełnienie
+    vector<unsigned> itemCells;
+    auto fill = [&](size_t itemCount, auto cellsOf, auto &offsets, auto &items)
+    {
+        offsets.assign(cells + 1, 0);
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            cellsOf(i, itemCells);
+            for (unsigned cell : itemCells)
+                offsets[cell + 1]++;
+        }
+        for (size_t c = 0; c < cells; ++c)
+            offsets[c + 1] += offsets[c];
+
+        items.resize(offsets[cells]);
+        vector<unsigned> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            cellsOf(i, itemCells);
+            for (unsigned cell : itemCells)
+                items[cursor[cell]++] = static_cast<unsigned>(i);
+        }
+    };
+
+    fill(m_nodes.size(), [&](size_t i, vector<unsigned> &out)
+         {
+             out.clear();
+             forEachCell(nodeRect(static_cast<TechId>(i)), [&](unsigned cell) { out.push_back(cell); }); },
+         m_nodeCellOffsets, m_nodeCellItems);
+    fill(m_edges.size(), [&](size_t i, vector<unsigned> &out) { edgeCells(m_edges[i], out); },
+         m_edgeCellOffsets, m_edgeCellItems);
+}
+
+void TechTreeLayout::query(const LayoutRect &area, vector<TechId> &outNodes, vector<unsigned> &outEdges)
+{
+    outNodes.clear();
+    outEdges.clear();
+
+    // przepełnienie licznika: stare znaczniki mogłyby udawać bieżące
+    if (++m_queryStamp == 0)
+    {
+        std::fill(m_nodeStamps.begin(), m_nodeStamps.end(), 0);
+        std::fill(m_edgeStamps.begin(), m_edgeStamps.end(), 0);
+        m_queryStamp = 1;
+    }
+
+    forEachCell(area, [&](unsigned cell)
+                {
+        for (unsigned k = m_nodeCellOffsets[cell]; k < m_nodeCellOffsets[cell + 1]; ++k)
+        {
+            const TechId techId = m_nodeCellItems[k];
+            if (m_nodeStamps[techId] == m_queryStamp)
+                continue;
+            m_nodeStamps[techId] = m_queryStamp;
+            if (nodeRect(techId).intersects(area))
+                outNodes.push_back(techId);
+        }
+
+        for (unsigned k = m_edgeCellOffsets[cell]; k < m_edgeCellOffsets[cell + 1]; ++k)
+        {
+            const unsigned edge = m_edgeCellItems[k];
+            if (m_edgeStamps[edge] == m_queryStamp)
+                continue;
+            m_edgeStamps[edge] = m_queryStamp;
+            if (edgeRect(m_edges[edge]).intersects(area))
+                outEdges.push_back(edge);
+        } });
+}
+
+optional<TechId> TechTreeLayout::hitTest(float x, float y) const
+{
+    optional<TechId> hit;
+    const LayoutRect point{x, y, x, y};
+
+    forEachCell(point, [&](unsigned cell)
+                {
+        for (unsigned k = m_nodeCellOffsets[cell]; k < m_nodeCellOffsets[cell + 1] && !hit; ++k)
+        {
+            if (nodeRect(m_nodeCellItems[k]).contains(x, y))
+                hit = m_nodeCellItems[k];
+        } });
+
+    return hit;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "ResearchManager.hpp"
+
+using std::optional;
+using std::vector;
+
+// Prostokąt w jednostkach świata drzewa (przed przesunięciem i zoomem widoku).
+struct LayoutRect
+{
+    float m_minX = 0.f;
+    float m_minY = 0.f;
+    float m_maxX = 0.f;
+    float m_maxY = 0.f;
+
+    bool intersects(const LayoutRect &other) const
+    {
+        return m_minX <= other.m_maxX && other.m_minX <= m_maxX &&
+               m_minY <= other.m_maxY && other.m_minY <= m_maxY;
+    }
+    bool contains(float x, float y) const
+    {
+        return x >= m_minX && x <= m_maxX && y >= m_minY && y <= m_maxY;
+    }
+};
+
+struct LayoutPoint
+{
+    float m_x = 0.f;
+    float m_y = 0.f;
+};
+
+// Pozycja węzła (lewy górny róg); indeks w TechTreeLayout::nodes() == TechId.
+struct TechNodeLayout
+{
+    float m_x = 0.f;
+    float m_y = 0.f;
+    unsigned m_layer = 0;
+};
+
+// Krawędź wymaganie -> technologia zależna.
+struct TechEdgeLayout
+{
+    TechId m_from = INVALID_TECH_ID;
+    TechId m_to = INVALID_TECH_ID;
+};
+
+// Warstwowy układ grafu technologii (każdy węzeł dokładnie raz, także przy
+// wspólnych potomkach) z indeksem przestrzennym do rysowania tylko widocznej części.
+//
+// Warstwa = najdłuższa ścieżka od korzenia (kolejność topologiczna), kolejność
+// w warstwach poprawiana kilkoma przebiegami barycentrycznymi, żeby krawędzie
+// się mniej krzyżowały. Węzły trafiają do jednolitej siatki komórek, krawędzie -
+// tylko do komórek, przez które biegnie ich krzywa (długa krawędź nie zajmuje całego
+// prostokąta otaczającego). Zapytanie o obszar odwiedza tylko komórki, które go
+// przecinają, więc koszt zależy od tego, co widać, a nie od wielkości drzewa.
+// Liczone raz po wczytaniu technologii (build); stan badań układu nie zmienia.
+class TechTreeLayout
+{
+public:
+    static const constexpr float NODE_WIDTH = 180.f;
+    static const constexpr float NODE_HEIGHT = 40.f;
+    static const constexpr float LAYER_GAP = 80.f;
+    static const constexpr float ROW_GAP = 16.f;
+    static const constexpr float CELL_SIZE = 256.f;
+    static const constexpr unsigned ORDERING_SWEEPS = 4;
+
+    void build(const ResearchManager &research);
+
+    const vector<TechNodeLayout> &nodes() const { return m_nodes; }
+    const vector<TechEdgeLayout> &edges() const { return m_edges; }
+    const LayoutRect &bounds() const { return m_bounds; }
+    unsigned layerCount() const { return m_layerCount; }
+
+    LayoutRect nodeRect(TechId techId) const;
+    LayoutRect edgeRect(const TechEdgeLayout &edge) const;
+    // Punkt krzywej krawędzi, t w [0, 1]: Bezier od prawego boku wymagania do lewego
+    // boku zależnej, punkty kontrolne w połowie odległości poziomej - krzywa nie
+    // wychodzi poza edgeRect. Widok powinien rysować tę samą krzywą.
+    LayoutPoint edgePoint(const TechEdgeLayout &edge, float t) const;
+
+    // Węzły i krawędzie (indeksy w edges()) przecinające obszar - każdy co najwyżej raz.
+    // Nie jest const: znaczniki odwiedzin są współdzielone między zapytaniami.
+    void query(const LayoutRect &area, vector<TechId> &outNodes, vector<unsigned> &outEdges);
+    // Węzeł pod punktem (tylko komórka punktu).
+    optional<TechId> hitTest(float x, float y) const;
+
+private:
+    void assignLayers(const ResearchManager &research, vector<vector<TechId>> &layers);
+    void orderLayers(const ResearchManager &research, vector<vector<TechId>> &layers);
+    void placeNodes(const vector<vector<TechId>> &layers);
+    void buildGrid();
+
+    // Wywołuje fn(indeks komórki) dla komórek przecinających prostokąt.
+    template <typename Fn>
+    void forEachCell(const LayoutRect &rect, Fn &&fn) const;
+    // Komórki, przez które przechodzi krzywa krawędzi (bez powtórzeń).
+    void edgeCells(const TechEdgeLayout &edge, vector<unsigned> &cells) const;
+
+private:
+    vector<TechNodeLayout> m_nodes;
+    vector<TechEdgeLayout> m_edges;
+    LayoutRect m_bounds;
+    unsigned m_layerCount = 0;
+
+    // Siatka w CSR: elementy komórki c leżą w m_*CellItems[m_*CellOffsets[c] .. m_*CellOffsets[c + 1]).
+    unsigned m_cellsX = 0;
+    unsigned m_cellsY = 0;
+    vector<unsigned> m_nodeCellOffsets;
+    vector<TechId> m_nodeCellItems;
+    vector<unsigned> m_edgeCellOffsets;
+    vector<unsigned> m_edgeCellItems;
+
+    // Numer zapytania, w którym element już trafił do wyniku (deduplikacja bez zbiorów).
+    vector<std::uint32_t> m_nodeStamps;
+    vector<std::uint32_t> m_edgeStamps;
+    std::uint32_t m_queryStamp = 0;
+};
@@ -0,0 +1,168 @@
+#include "BudgetForecast.hpp"
+#include "ResourcesManager.hpp"
+#include <algorithm>
+#include <climits>
+
+using std::clamp;
+using std::min;
+
+BudgetForecast::BudgetForecast(const ResourcesManager &resources)
+    : BudgetForecast(BudgetLevels{resources.getMoney(), resources.getMorale(), resources.getSecurity()},
+                     resources.dailyTotalCost(), resources.getResourceConstraints())
+{
+}
+
+BudgetForecast::BudgetForecast(const BudgetLevels &levels, long dailyCost, const ResourceConstraints &constraints)
+    : m_start(levels),
+      m_dailyCost(dailyCost),
+      m_constraints(constraints)
+{
+}
+
+// =====================================================
+// ZDARZENIA
+// =====================================================
+void BudgetForecast::insertEvent(const CostEvent &event)
+{
+    auto it = std::upper_bound(m_events.begin(), m_events.end(), event.m_day,
+                               [](unsigned short day, const CostEvent &e) { return day < e.m_day; });
+    m_events.insert(it, event);
+}
+
+void BudgetForecast::addCostChange(unsigned short day, long delta)
+{
+    if (delta != 0)
+        insertEvent({day, delta, 0});
+}
+
+void BudgetForecast::addCostInterval(unsigned short firstDay, unsigned short lastDay, long dailyCost)
+{
+    if (lastDay < firstDay || dailyCost == 0)
+        return;
+    addCostChange(firstDay, dailyCost);
+    if (lastDay < USHRT_MAX)
+        addCostChange(lastDay + 1, -dailyCost);
+}
+
+void BudgetForecast::addExpense(unsigned short day, long amount)
+{
+    if (amount != 0)
+        insertEvent({day, 0, amount});
+}
+
+// =====================================================
+// POSTAĆ ZAMKNIĘTA
+// =====================================================
+BudgetStep BudgetForecast::advance(const BudgetLevels &levels, long dailyCost, unsigned days,
+                                   const ResourceConstraints &constraints)
+{
+    BudgetStep step;
+    step.m_levels = levels;
+    if (days == 0)
+        return step;
+
+    if (levels.m_money <= 0)
+        step.m_solventDays = 0;
+    else if (dailyCost <= 0)
+        step.m_solventDays = days;
+    else
+        step.m_solventDays = static_cast<unsigned>(min<long>(days, (levels.m_money - 1) / dailyCost));
+
+    const unsigned insolventDays = days - step.m_solventDays;
+    BudgetLevels &out = step.m_levels;
+    out.m_money -= dailyCost * static_cast<long>(days);
+
+    const unsigned minMorale = constraints.minimal_total_morale;
+    const unsigned maxMorale = constraints.maximal_total_morale;
+    const unsigned minSecurity = constraints.minimal_total_security;
+    const unsigned maxSecurity = constraints.maximal_total_security;
+
+    // Te same nasycenia co addMorale/reduceMorale - zbiorczo równe liczeniu dzień po dniu,
+    // bo dni wypłacalne poprzedzają niewypłacalne.
+    if (step.m_solventDays > 0)
+        out.m_morale = clamp(out.m_morale + step.m_solventDays, minMorale, maxMorale);
+
+    if (insolventDays > 0)
+    {
+        const unsigned moraleLoss = 2 * insolventDays;
+        out.m_morale = clamp(moraleLoss > out.m_morale ? 0u : out.m_morale - moraleLoss, minMorale, maxMorale);
+        out.m_security = clamp(insolventDays > out.m_security ? 0u : out.m_security - insolventDays,
+                               minSecurity, maxSecurity);
+    }
+
+    return step;
+}
+
+// =====================================================
+// PROGNOZA
+// =====================================================
+template <typename Visitor>
+void BudgetForecast::forEachPiece(unsigned short days, Visitor &&visit) const
+{
+    BudgetLevels levels = m_start;
+    long cost = m_dailyCost;
+    unsigned elapsed = 0;
+    auto event = m_events.begin();
+
+    while (elapsed < days)
+    {
+        // zdarzenia dnia elapsed + 1 (i zaległe) działają przed jego rozliczeniem
+        while (event != m_events.end() && event->m_day <= elapsed + 1)
+        {
+            cost += event->m_costDelta;
+            levels.m_money -= event->m_expense;
+            ++event;
+        }
+
+        unsigned end = days;
+        if (event != m_events.end())
+            end = min<unsigned>(end, event->m_day - 1u);
+
+        const unsigned length = end - elapsed;
+        const BudgetStep step = advance(levels, cost, length, m_constraints);
+        visit(elapsed, length, levels, cost, step);
+
+        levels = step.m_levels;
+        elapsed = end;
+    }
+}
+
+BudgetForecastSummary BudgetForecast::project(unsigned short days) const
+{
+    BudgetForecastSummary summary;
+    summary.m_final = m_start;
+    const unsigned minMorale = m_constraints.minimal_total_morale;
+
+    forEachPiece(days, [&](unsigned first, unsigned length, const BudgetLevels &levels, long cost, const BudgetStep &step)
+                 {
+        // wydatki jednorazowe na granicy odcinka + koszt dzienny odcinka
+        summary.m_totalCost += summary.m_final.m_money - levels.m_money + cost * static_cast<long>(length);
+        summary.m_final = step.m_levels;
+
+        if (step.m_solventDays == length)
+            return;
+
+        const unsigned firstInsolvent = first + step.m_solventDays + 1;
+        if (!summary.m_firstInsolventDay)
+            summary.m_firstInsolventDay = static_cast<unsigned short>(firstInsolvent);
+
+        if (summary.m_moraleDepletedDay)
+            return;
+
+        // morale po dniach wypłacalnych, potem -2 dziennie aż do minimum
+        const unsigned morale = advance(levels, cost, step.m_solventDays, m_constraints).m_levels.m_morale;
+        const unsigned insolventDay = morale <= minMorale ? 1 : (morale - minMorale + 1) / 2;
+        if (insolventDay <= length - step.m_solventDays)
+            summary.m_moraleDepletedDay = static_cast<unsigned short>(firstInsolvent + insolventDay - 1); });
+
+    return summary;
+}
+
+void BudgetForecast::projectSeries(unsigned short days, vector<BudgetLevels> &out) const
+{
+    out.resize(days);
+    forEachPiece(days, [&](unsigned first, unsigned length, const BudgetLevels &levels, long cost, const BudgetStep &)
+                 {
+        for (unsigned i = 1; i <= length; ++i)
+            out[first + i - 1] = advance(levels, cost, i, m_constraints).m_levels; });
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <optional>
+#include <vector>
+#include "ResourceConstraints.hpp"
+
+using std::optional;
+using std::vector;
+
+class ResourcesManager;
+
+// Stan rozliczany codziennie przez ResourcesManager (pieniądze, morale, bezpieczeństwo).
+struct BudgetLevels
+{
+    long m_money = 0;
+    unsigned m_morale = 0;
+    unsigned m_security = 0;
+};
+
+// Wynik `days` dni przy stałym koszcie dziennym.
+struct BudgetStep
+{
+    BudgetLevels m_levels;
+    // Dni na plusie - zawsze początek odcinka, bo saldo maleje liniowo.
+    unsigned m_solventDays = 0;
+};
+
+struct BudgetForecastSummary
+{
+    BudgetLevels m_final;
+    long m_totalCost = 0;
+    // Dni liczone od dziś (1 = jutro); nullopt = nie nastąpi w horyzoncie prognozy.
+    optional<unsigned short> m_firstInsolventDay;
+    optional<unsigned short> m_moraleDepletedDay;
+};
+
+// Prognoza pieniędzy, morale i bezpieczeństwa na najbliższe dni.
+//
+// Koszt dzienny jest kawałkami stały: zmienia się tylko w dniach zgłoszonych przez
+// addCostChange (np. koniec trwającego badania), a wydatki jednorazowe spadają
+// na początek wskazanego dnia. Każdy odcinek liczony jest w postaci zamkniętej tą samą
+// regułą co ResourcesManager::onDaysPassed, więc prognoza kosztuje O(liczba zmian),
+// a seria dzień po dniu O(dni) - bez kopiowania świata i symulowania.
+class BudgetForecast
+{
+public:
+    // Stan początkowy i koszt dzienny (personel + trwające badania) z managera.
+    explicit BudgetForecast(const ResourcesManager &resources);
+    BudgetForecast(const BudgetLevels &levels, long dailyCost, const ResourceConstraints &constraints);
+
+    // Od dnia `day` (1 = jutro) koszt dzienny zmienia się o `delta`.
+    void addCostChange(unsigned short day, long delta);
+    // Dodatkowy koszt `dailyCost` w dniach [firstDay, lastDay].
+    void addCostInterval(unsigned short firstDay, unsigned short lastDay, long dailyCost);
+    // Wydatek jednorazowy pobierany na początku dnia `day`.
+    void addExpense(unsigned short day, long amount);
+
+    BudgetForecastSummary project(unsigned short days) const;
+    // Stan po każdym dniu: out[0] = jutro. Bufor jest nadpisywany (bez realokacji przy stałym `days`).
+    void projectSeries(unsigned short days, vector<BudgetLevels> &out) const;
+
+    long dailyCost() const { return m_dailyCost; }
+    const BudgetLevels &start() const { return m_start; }
+
+    // Reguła dnia w postaci zamkniętej: dzień i jest wypłacalny, gdy money - i * cost > 0.
+    // Wypłacalne dni podnoszą morale o 1, pozostałe obniżają morale o 2 i bezpieczeństwo o 1.
+    static BudgetStep advance(const BudgetLevels &levels, long dailyCost, unsigned days,
+                              const ResourceConstraints &constraints);
+
+private:
+    struct CostEvent
+    {
+        unsigned short m_day = 0;
+        long m_costDelta = 0;
+        long m_expense = 0;
+    };
+
+    void insertEvent(const CostEvent &event);
+
+    // Przechodzi odcinki o stałym koszcie; visit(początek, długość, stan, koszt, krok).
+    template <typename Visitor>
+    void forEachPiece(unsigned short days, Visitor &&visit) const;
+
+private:
+    BudgetLevels m_start;
+    long m_dailyCost = 0;
+    // Prognoza żyje krócej niż konfiguracja (tworzona na zapytanie).
+    const ResourceConstraints &m_constraints;
+    // Posortowane po dniu.
+    vector<CostEvent> m_events;
+};
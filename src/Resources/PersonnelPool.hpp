@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include "ResourceConstraints.hpp"
+
+using std::array;
+using std::size_t;
+
+// Role personelu. Nowa rola = nowa pozycja przed Count + wpis w fromConstraints().
+enum class PersonnelRole : unsigned char
+{
+    Workers,
+    Scientists,
+    Engineers,
+    ArmyPersonnel,
+    Count
+};
+
+static const constexpr size_t PERSONNEL_ROLE_COUNT = static_cast<size_t>(PersonnelRole::Count);
+
+inline constexpr size_t roleIndex(PersonnelRole role) { return static_cast<size_t>(role); }
+
+inline constexpr const char *personnelRoleName(PersonnelRole role)
+{
+    switch (role)
+    {
+    case PersonnelRole::Workers:
+        return "Workers";
+    case PersonnelRole::Scientists:
+        return "Scientists";
+    case PersonnelRole::Engineers:
+        return "Engineers";
+    case PersonnelRole::ArmyPersonnel:
+        return "Army Personnel";
+    default:
+        return "";
+    }
+}
+
+// Personel w układzie structure-of-arrays: każda tablica indeksowana rolą.
+// Koszt dzienny całego personelu to jeden iloczyn skalarny working * dailyCost.
+struct PersonnelPool
+{
+    using RoleArray = array<unsigned int, PERSONNEL_ROLE_COUNT>;
+
+    // Liczba osób możliwych do zatrudnienia.
+    RoleArray m_total{};
+    // Obecnie pracujący.
+    RoleArray m_working{};
+    // Zatrudnieni w bieżącym dniu. Zerowane na koniec dnia.
+    RoleArray m_hiredInDay{};
+    RoleArray m_dailyCost{};
+    RoleArray m_hiringCost{};
+    RoleArray m_maximumTotal{};
+
+    static PersonnelPool fromConstraints(const ResourceConstraints &constraints)
+    {
+        PersonnelPool pool;
+        auto set = [&](PersonnelRole role, unsigned int total, unsigned int maximum,
+                       unsigned int dailyCost, unsigned int hiringCost)
+        {
+            const size_t i = roleIndex(role);
+            pool.m_total[i] = total;
+            pool.m_maximumTotal[i] = maximum;
+            pool.m_dailyCost[i] = dailyCost;
+            pool.m_hiringCost[i] = hiringCost;
+        };
+
+        set(PersonnelRole::Workers, constraints.initial_total_workers, constraints.maximum_total_workers,
+            constraints.worker_daily_cost, constraints.worker_hiring_cost);
+        set(PersonnelRole::Scientists, constraints.initial_total_scientists, constraints.maximum_total_scientists,
+            constraints.scientist_daily_cost, constraints.scientist_hiring_cost);
+        set(PersonnelRole::Engineers, constraints.initial_total_engineers, constraints.maximum_total_engineers,
+            constraints.engineer_daily_cost, constraints.engineer_hiring_cost);
+        set(PersonnelRole::ArmyPersonnel, constraints.initial_total_army_personnel, constraints.maximum_total_army_personnel,
+            constraints.army_personnel_daily_cost, constraints.army_personnel_hiring_cost);
+        return pool;
+    }
+
+    unsigned long dailyCost() const
+    {
+        unsigned long total = 0;
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+            total += static_cast<unsigned long>(m_working[i]) * m_dailyCost[i];
+        return total;
+    }
+
+    unsigned long totalHeadcount() const
+    {
+        unsigned long total = 0;
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+            total += m_total[i];
+        return total;
+    }
+};
@@ -4,6 +4,8 @@
 #include <nlohmann/json.hpp>
 
 #include "ResourceConstraints.hpp"
+#include "../Core/header/DataCache.hpp"
+#include "../Core/header/Snapshot.hpp"
 
 using std::ifstream;
 using std::cerr;
@@ -97,3 +99,56 @@ bool ResourceConstraints::loadFromJson(const string &path)
 
     return true;
 }
+
+namespace
+{
+    // "MPRC"
+    const constexpr std::uint32_t CONSTRAINTS_CACHE_MAGIC = 0x4352504D;
+}
+
+void ResourceConstraints::writeBinary(SnapshotWriter &writer) const
+{
+    writer.write(CONSTRAINTS_CACHE_MAGIC);
+    writer.write(DATA_CACHE_VERSION);
+    // same pola liczbowe - cała struktura naraz, rozmiar chroni przed zmianą układu
+    writer.write(static_cast<std::uint32_t>(sizeof(ResourceConstraints)));
+    writer.write(*this);
+}
+
+bool ResourceConstraints::readBinary(SnapshotReader &reader)
+{
+    std::uint32_t magic = 0;
+    std::uint16_t version = 0;
+    std::uint32_t size = 0;
+    if (!reader.read(magic) || !reader.read(version) || !reader.read(size))
+        return false;
+
+    if (magic != CONSTRAINTS_CACHE_MAGIC || version != DATA_CACHE_VERSION || size != sizeof(ResourceConstraints))
+        return false;
+
+    ResourceConstraints loaded;
+    if (!reader.read(loaded))
+        return false;
+
+    *this = loaded;
+    return true;
+}
+
+bool ResourceConstraints::loadFromJsonCached(const string &path)
+{
+    if (isBinaryCacheFresh(path))
+    {
+        MappedFile file(binaryCachePath(path));
+        SnapshotReader reader(file.bytes());
+        if (file.isOpen() && readBinary(reader))
+            return true;
+    }
+
+    if (!loadFromJson(path))
+        return false;
+
+    SnapshotWriter writer;
+    writeBinary(writer);
+    writeBinaryCache(path, writer.bytes());
+    return true;
+}
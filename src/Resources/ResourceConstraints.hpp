@@ -3,6 +3,9 @@
 
 using std::string;
 
+class SnapshotWriter;
+class SnapshotReader;
+
 struct ResourceConstraints
 {
     // money
@@ -64,4 +67,9 @@ struct ResourceConstraints
 
     // method
     bool loadFromJson(const string &path);
+    // Jak loadFromJson, ale z binarnego cache "<path>.bin", jeśli jest nowszy niż JSON.
+    // W przeciwnym razie parsuje JSON i zapisuje cache na następny start.
+    bool loadFromJsonCached(const string &path);
+    void writeBinary(SnapshotWriter &writer) const;
+    bool readBinary(SnapshotReader &reader);
 };
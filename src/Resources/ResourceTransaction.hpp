@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include "PersonnelPool.hpp"
+
+using std::vector;
+
+// Zmiana liczby pracujących jednej roli: > 0 zatrudnienie, < 0 zwolnienie.
+struct PersonnelDelta
+{
+    PersonnelRole m_role = PersonnelRole::Workers;
+    long m_delta = 0;
+};
+
+// Pakiet zmian zasobów zatwierdzany przez ResourcesManager::applyTransaction
+// w całości albo wcale. Wpisy tej samej roli się sumują (zatrudnij 10 + zwolnij 4 = +6),
+// koszt zatrudnienia liczony jest od sumy dodatniej.
+struct ResourceTransaction
+{
+    vector<PersonnelDelta> m_personnel;
+    long m_money = 0;
+    long m_uranium = 0;
+    long m_plutonium = 0;
+
+    ResourceTransaction &hire(PersonnelRole role, unsigned int count)
+    {
+        m_personnel.push_back({role, static_cast<long>(count)});
+        return *this;
+    }
+    ResourceTransaction &fire(PersonnelRole role, unsigned int count)
+    {
+        m_personnel.push_back({role, -static_cast<long>(count)});
+        return *this;
+    }
+    bool empty() const
+    {
+        return m_personnel.empty() && m_money == 0 && m_uranium == 0 && m_plutonium == 0;
+    }
+    // Czyści bez zwalniania pamięci (planer może używać jednej transakcji wielokrotnie).
+    void clear()
+    {
+        m_personnel.clear();
+        m_money = m_uranium = m_plutonium = 0;
+    }
+};
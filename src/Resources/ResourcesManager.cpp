@@ -1,4 +1,6 @@
 #include "ResourcesManager.hpp"
+#include "BudgetForecast.hpp"
+#include "../Core/header/Snapshot.hpp"
 #include <algorithm>
 
 using std::clamp;
@@ -8,18 +10,7 @@ using std::make_shared;
 
 ResourcesManager::ResourcesManager(ResourceConstraints &constraints, TimeDataModel &timeSystem)
     : m_resourceConstraints(constraints),
-      m_totalWorkers(constraints.initial_total_workers),
-      m_workingWorkers(0),
-      m_hiredWorkersInDay(0),
-      m_totalScientists(constraints.initial_total_scientists),
-      m_workingScientists(0),
-      m_hiredScientistsInDay(0),
-      m_totalEngineers(constraints.initial_total_engineers),
-      m_workingEngineers(0),
-      m_hiredEngineersInDay(0),
-      m_totalArmyPersonnel(constraints.initial_total_army_personnel),
-      m_workingArmyPersonnel(0),
-      m_hiredArmyPersonnelInDay(0),
+      m_personnel(PersonnelPool::fromConstraints(constraints)),
       m_money(constraints.initial_money),
       m_uranium(constraints.initial_uranium),
       m_plutonium(constraints.initial_plutonium),
@@ -27,354 +18,108 @@ ResourcesManager::ResourcesManager(ResourceConstraints &constraints, TimeDataMod
       m_totalSecurity(constraints.initial_security),
       m_timeModel(timeSystem)    
 {
-    m_dayObserverHandle =
-        make_shared<TimeDataModel::DayPassedCallback>(
-            [this](const TimeDataModel& t)
-            {
-                onDayPassed(t);
-            });
-
-    m_timeModel.addDayObserver(m_dayObserverHandle);
+    // rozliczenie zasobów przed postępem badań w tym samym dniu
+    m_daysSubscription = m_timeModel.subscribeDays(
+        [this](const TimeDataModel& t, unsigned short firstDay, unsigned short count)
+        {
+            onDaysPassed(t, firstDay, count);
+        },
+        OBSERVER_PRIORITY_RESOURCES);
 }
 
-void ResourcesManager::onDayPassed(const TimeDataModel&)
+void ResourcesManager::onDaysPassed(const TimeDataModel&, unsigned short, unsigned short count)
 {
-    // 1️⃣ Dzienne koszty personelu
-    long dailyCost =
-        dailyWorkersCost() +
-        dailyScientistsCost() +
-        dailyEngineersCost() +
-        dailyArmyPersonnelCost();
-
-    m_money -= dailyCost;
+    // 1️⃣ Dzienne koszty personelu i trwających badań (stałe w całej paczce -
+    //    TimeDataModel tnie paczki na ukończeniach badań, nikt nie zatrudnia w trakcie skoku)
+    // 2️⃣ Saldo maleje liniowo, więc dni "na plusie" to początek paczki - postać zamknięta
+    //    wspólna z prognozą budżetu
+    const BudgetStep step = BudgetForecast::advance(
+        BudgetLevels{m_money, m_totalMorale, m_totalSecurity}, dailyTotalCost(), count, m_resourceConstraints);
 
-    // 2️⃣ Jeśli nie stać nas na utrzymanie
-    if (m_money <= 0)
-    {
-        // morale spada szybciej
-        reduceMorale(2);
-        reduceSecurity(1);
-    }
-    else
-    {
-        // stabilny projekt
-        addMorale(1);
-    }
+    m_money = step.m_levels.m_money;
+    m_totalMorale = step.m_levels.m_morale;
+    m_totalSecurity = step.m_levels.m_security;
 
     // 3️⃣ Reset liczników dziennych
     resetDailyHiredPersonnelCounts();
 }
 
 
-bool ResourcesManager::hireWorkers(unsigned int count)
-{
-    unsigned int available = getAvailableToHireWorkers();
-    unsigned long cost = count * m_resourceConstraints.worker_hiring_cost;
-
-    if (available >= count && m_money >= cost)
-    {
-        m_workingWorkers += count;
-        m_hiredWorkersInDay += count;
-        m_money -= cost;
-        return true;
-    }
-    return false;
-}
-
-bool ResourcesManager::fireWorkers(unsigned int count)
-{
-    if (m_workingWorkers >= count)
-    {
-        m_workingWorkers -= count;
-        return true;
-    }
-    return false;
-}
-
-unsigned int ResourcesManager::getAvailableToHireWorkers() const
-{
-    return m_totalWorkers - m_workingWorkers;
-}
-
-unsigned int ResourcesManager::dailyWorkersCost() const
-{
-    unsigned int totalCost = 0;
-    totalCost += m_workingWorkers * m_resourceConstraints.worker_daily_cost;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::tenDaysWorkersCost() const
-{
-    unsigned int totalCost = dailyWorkersCost() * 10;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::thirtyDaysWorkersCost() const
-{
-    unsigned int totalCost = dailyWorkersCost() * 30;
-    return totalCost;
-}
-
-bool ResourcesManager::hireScientists(unsigned int count)
-{
-    unsigned int available = getAvailableToHireScientists();
-    unsigned long cost = count * m_resourceConstraints.scientist_hiring_cost;
-    if (available >= count && m_money >= cost)
-    {
-        m_workingScientists += count;
-        m_hiredScientistsInDay += count;
-        m_money -= cost;
-        return true;
-    }
-    return false;
-}
-
-bool ResourcesManager::fireScientists(unsigned int count)
-{
-    if (m_workingScientists >= count)
-    {
-        m_workingScientists -= count;
-        return true;
-    }
-    return false;
-}
-
-unsigned int ResourcesManager::getAvailableToHireScientists() const
-{
-    return m_totalScientists - m_workingScientists;
-}
-
-unsigned int ResourcesManager::dailyScientistsCost() const
-{
-    unsigned int totalCost = 0;
-    totalCost += m_workingScientists * m_resourceConstraints.scientist_daily_cost;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::tenDaysScientistsCost() const
-{
-    unsigned int totalCost = dailyScientistsCost() * 10;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::thirtyDaysScientistsCost() const
+bool ResourcesManager::hire(PersonnelRole role, unsigned int count)
 {
-    unsigned int totalCost = dailyScientistsCost() * 30;
-    return totalCost;
-}
+    const size_t i = roleIndex(role);
+    const long cost = static_cast<long>(count) * m_personnel.m_hiringCost[i];
 
-bool ResourcesManager::hireEngineers(unsigned int count)
-{
-    unsigned int available = getAvailableToHireEngineers();
-    unsigned long cost = count * m_resourceConstraints.engineer_hiring_cost;
-    if (available >= count && m_money >= cost)
+    if (getAvailableToHire(role) >= count && m_money >= cost)
     {
-        m_workingEngineers += count;
-        m_hiredEngineersInDay += count;
+        m_personnel.m_working[i] += count;
+        m_personnel.m_hiredInDay[i] += count;
         m_money -= cost;
         return true;
     }
     return false;
 }
 
-bool ResourcesManager::fireEngineers(unsigned int count)
-{
-    if (m_workingEngineers >= count)
-    {
-        m_workingEngineers -= count;
-        return true;
-    }
-    return false;
-}
-
-unsigned int ResourcesManager::getAvailableToHireEngineers() const
-{
-    return m_totalEngineers - m_workingEngineers;
-}
-
-unsigned int ResourcesManager::dailyEngineersCost() const
-{
-    unsigned int totalCost = 0;
-    totalCost += m_workingEngineers * m_resourceConstraints.engineer_daily_cost;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::tenDaysEngineersCost() const
-{
-    unsigned int totalCost = dailyEngineersCost() * 10;
-    return totalCost;
-}
-
-unsigned int ResourcesManager::thirtyDaysEngineersCost() const
-{
-    unsigned int totalCost = dailyEngineersCost() * 30;
-    return totalCost;
-}
-
-bool ResourcesManager::hireArmyPersonnel(unsigned int count)
+bool ResourcesManager::fire(PersonnelRole role, unsigned int count)
 {
-    unsigned int available = getAvailableToHireArmyPersonnel();
-    unsigned long cost = count * m_resourceConstraints.army_personnel_hiring_cost;
-    if (available >= count && m_money >= cost)
+    const size_t i = roleIndex(role);
+    if (m_personnel.m_working[i] >= count)
     {
-        m_workingArmyPersonnel += count;
-        m_hiredArmyPersonnelInDay += count;
-        m_money -= cost;
+        m_personnel.m_working[i] -= count;
         return true;
     }
     return false;
 }
 
-bool ResourcesManager::fireArmyPersonnel(unsigned int count)
+unsigned int ResourcesManager::getAvailableToHire(PersonnelRole role) const
 {
-    if (m_workingArmyPersonnel >= count)
-    {
-        m_workingArmyPersonnel -= count;
-        return true;
-    }
-    return false;
+    const size_t i = roleIndex(role);
+    return m_personnel.m_total[i] - m_personnel.m_working[i];
 }
 
-unsigned int ResourcesManager::getAvailableToHireArmyPersonnel() const
+unsigned int ResourcesManager::dailyCost(PersonnelRole role) const
 {
-    return m_totalArmyPersonnel - m_workingArmyPersonnel;
+    const size_t i = roleIndex(role);
+    return m_personnel.m_working[i] * m_personnel.m_dailyCost[i];
 }
 
-unsigned int ResourcesManager::dailyArmyPersonnelCost() const
+bool ResourcesManager::setTotal(PersonnelRole role, unsigned int count)
 {
-    unsigned int totalCost = 0;
-    totalCost += m_workingArmyPersonnel * m_resourceConstraints.army_personnel_daily_cost;
-    return totalCost;
-}
-unsigned int ResourcesManager::tenDaysArmyPersonnelCost() const
-{
-    unsigned int totalCost = dailyArmyPersonnelCost() * 10;
-    return totalCost;
-}
-unsigned int ResourcesManager::thirtyDaysArmyPersonnelCost() const
-{
-    unsigned int totalCost = dailyArmyPersonnelCost() * 30;
-    return totalCost;
+    const size_t i = roleIndex(role);
+    const unsigned long otherTotals = m_personnel.totalHeadcount() - m_personnel.m_total[i];
+    if (count + otherTotals > m_resourceConstraints.total_numbers_of_all_personnel)
+        return false;
+    if (count > m_personnel.m_maximumTotal[i])
+        return false;
+    m_personnel.m_total[i] = count;
+    return true;
 }
 
 bool ResourcesManager::checkTotalNumbersOfAllPersonnel() const
 {
-    unsigned int currentTotal = m_totalWorkers + m_totalScientists + m_totalEngineers + m_totalArmyPersonnel;
-    if (currentTotal <= m_resourceConstraints.total_numbers_of_all_personnel)
-        return true;
-    return false;
+    return m_personnel.totalHeadcount() <= m_resourceConstraints.total_numbers_of_all_personnel;
 }
 
 void ResourcesManager::resetDailyHiredPersonnelCounts()
 {
-    m_hiredWorkersInDay = 0;
-    m_hiredScientistsInDay = 0;
-    m_hiredEngineersInDay = 0;
-    m_hiredArmyPersonnelInDay = 0;
+    m_personnel.m_hiredInDay.fill(0);
 }
 
 unsigned long ResourcesManager::dailyPersonnelCost() const
 {
-    unsigned long totalCost = 0;
-    totalCost += dailyWorkersCost();
-    totalCost += dailyScientistsCost();
-    totalCost += dailyEngineersCost();
-    totalCost += dailyArmyPersonnelCost();
-    return totalCost;
+    return m_personnel.dailyCost();
 }
 unsigned long ResourcesManager::tenDaysPersonnelCost() const
 {
-    unsigned long totalCost = 0;
-    totalCost += tenDaysWorkersCost();
-    totalCost += tenDaysScientistsCost();
-    totalCost += tenDaysEngineersCost();
-    totalCost += tenDaysArmyPersonnelCost();
-    return totalCost;
+    return dailyPersonnelCost() * 10;
 }
 unsigned long ResourcesManager::thirtyDaysPersonnelCost() const
 {
-    unsigned long totalCost = 0;
-    totalCost += thirtyDaysWorkersCost();
-    totalCost += thirtyDaysScientistsCost();
-    totalCost += thirtyDaysEngineersCost();
-    totalCost += thirtyDaysArmyPersonnelCost();
-    return totalCost;
-}
-// Getters for personnel counts
-unsigned int ResourcesManager::getTotalWorkers() const
-{
-    return m_totalWorkers;
+    return dailyPersonnelCost() * 30;
 }
-unsigned int ResourcesManager::getWorkingWorkers() const
+long ResourcesManager::dailyTotalCost() const
 {
-    return m_workingWorkers;
-}
-unsigned int ResourcesManager::getTotalScientists() const
-{
-    return m_totalScientists;
-}
-unsigned int ResourcesManager::getWorkingScientists() const
-{
-    return m_workingScientists;
-}
-unsigned int ResourcesManager::getTotalEngineers() const
-{
-    return m_totalEngineers;
-}
-unsigned int ResourcesManager::getWorkingEngineers() const
-{
-    return m_workingEngineers;
-}
-unsigned int ResourcesManager::getTotalArmyPersonnel() const
-{
-    return m_totalArmyPersonnel;
-}
-unsigned int ResourcesManager::getWorkingArmyPersonnel() const
-{
-    return m_workingArmyPersonnel;
-}
-// Setters for personnel counts
-bool ResourcesManager::setTotalWorkers(unsigned int count)
-{
-    unsigned int otherTotals = m_totalScientists + m_totalEngineers + m_totalArmyPersonnel;
-    if (count + otherTotals > m_resourceConstraints.total_numbers_of_all_personnel)
-        return false;
-    if (count > m_resourceConstraints.maximum_total_workers)
-        return false;
-    m_totalWorkers = count;
-    return true;
-}
-
-bool ResourcesManager::setTotalScientists(unsigned int count)
-{
-    unsigned int otherTotals = m_totalWorkers + m_totalEngineers + m_totalArmyPersonnel;
-    if (count + otherTotals > m_resourceConstraints.total_numbers_of_all_personnel)
-        return false;
-    if (count > m_resourceConstraints.maximum_total_scientists)
-        return false;
-    m_totalScientists = count;
-    return true;
-}
-
-bool ResourcesManager::setTotalEngineers(unsigned int count)
-{
-    unsigned int otherTotals = m_totalWorkers + m_totalScientists + m_totalArmyPersonnel;
-    if (count + otherTotals > m_resourceConstraints.total_numbers_of_all_personnel)
-        return false;
-    if (count > m_resourceConstraints.maximum_total_engineers)
-        return false;
-    m_totalEngineers = count;
-    return true;
-}
-bool ResourcesManager::setTotalArmyPersonnel(unsigned int count)
-{
-    unsigned int otherTotals = m_totalWorkers + m_totalScientists + m_totalEngineers;
-    if (count + otherTotals > m_resourceConstraints.total_numbers_of_all_personnel)
-        return false;
-    if (count > m_resourceConstraints.maximum_total_army_personnel)
-        return false;
-    m_totalArmyPersonnel = count;
-    return true;
+    return static_cast<long>(dailyPersonnelCost()) + m_researchDailyCost;
 }
 // Resource stats management
 long ResourcesManager::getMoney() const
@@ -497,8 +242,178 @@ ResourceConstraints& ResourcesManager::getResourceConstraints() const
     return m_resourceConstraints;
 }
 
+// =====================================================
+// TRANSAKCJE
+// =====================================================
+namespace
+{
+    bool &missingPersonnel(ResourceMissing &missing, PersonnelRole role)
+    {
+        switch (role)
+        {
+        case PersonnelRole::Workers:
+            return missing.workers;
+        case PersonnelRole::Scientists:
+            return missing.scientists;
+        case PersonnelRole::Engineers:
+            return missing.engineers;
+        default:
+            return missing.army;
+        }
+    }
+}
+
+bool ResourcesManager::prepareTransaction(const ResourceTransaction &transaction, PreparedTransaction &prepared,
+                                          ResourceMissing &missing) const
+{
+    for (const auto &entry : transaction.m_personnel)
+        prepared.m_personnel[roleIndex(entry.m_role)] += entry.m_delta;
+
+    // Personel: zatrudnić można dostępnych, zwolnić - pracujących
+    long hiringCost = 0;
+    bool valid = true;
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+    {
+        const long delta = prepared.m_personnel[i];
+        const bool fits = delta >= 0 ? delta <= static_cast<long>(m_personnel.m_total[i] - m_personnel.m_working[i])
+                                     : -delta <= static_cast<long>(m_personnel.m_working[i]);
+        if (!fits)
+        {
+            missingPersonnel(missing, static_cast<PersonnelRole>(i)) = true;
+            valid = false;
+        }
+        if (delta > 0)
+            hiringCost += delta * static_cast<long>(m_personnel.m_hiringCost[i]);
+    }
+
+    // Pieniądze: jak hire/spendMoney - wydatek nie może zejść poniżej zera,
+    // wpływ nie może przekroczyć budżetu maksymalnego (bez cichego obcinania jak w addMoney)
+    const long moneyChange = transaction.m_money - hiringCost;
+    prepared.m_money = m_money + moneyChange;
+    if ((moneyChange < 0 && prepared.m_money < 0) ||
+        (moneyChange > 0 && prepared.m_money > static_cast<long>(m_resourceConstraints.maximum_budget)))
+    {
+        missing.money = true;
+        valid = false;
+    }
+
+    prepared.m_uranium = static_cast<long>(m_uranium) + transaction.m_uranium;
+    if (prepared.m_uranium < 0 || prepared.m_uranium > static_cast<long>(m_resourceConstraints.maximal_uranium))
+    {
+        missing.uranium = true;
+        valid = false;
+    }
+
+    prepared.m_plutonium = static_cast<long>(m_plutonium) + transaction.m_plutonium;
+    if (prepared.m_plutonium < 0 || prepared.m_plutonium > static_cast<long>(m_resourceConstraints.maximal_plutonium))
+    {
+        missing.plutonium = true;
+        valid = false;
+    }
+
+    return valid;
+}
+
+ResourceMissing ResourcesManager::validateTransaction(const ResourceTransaction &transaction) const
+{
+    PreparedTransaction prepared;
+    ResourceMissing missing;
+    prepareTransaction(transaction, prepared, missing);
+    return missing;
+}
+
+bool ResourcesManager::applyTransaction(const ResourceTransaction &transaction, ResourceMissing *missing)
+{
+    PreparedTransaction prepared;
+    ResourceMissing report;
+    if (!prepareTransaction(transaction, prepared, report))
+    {
+        if (missing != nullptr)
+            *missing = report;
+        return false;
+    }
+
+    // wszystko sprawdzone - zatwierdzenie nie może się już nie udać
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+    {
+        const long delta = prepared.m_personnel[i];
+        m_personnel.m_working[i] = static_cast<unsigned int>(static_cast<long>(m_personnel.m_working[i]) + delta);
+        if (delta > 0)
+            m_personnel.m_hiredInDay[i] += static_cast<unsigned int>(delta);
+    }
+    m_money = prepared.m_money;
+    m_uranium = static_cast<unsigned int>(prepared.m_uranium);
+    m_plutonium = static_cast<unsigned int>(prepared.m_plutonium);
+
+    if (missing != nullptr)
+        *missing = report;
+    return true;
+}
+
+optional<unsigned short> ResourcesManager::daysUntilNextEvent() const
+{
+    const long dailyCost = dailyTotalCost();
+
+    // Saldo przejdzie przez zero w dniu ceil(m_money / dailyCost)
+    if (m_money > 0)
+    {
+        if (dailyCost == 0)
+            return std::nullopt;
+
+        long days = (m_money + dailyCost - 1) / dailyCost;
+        return static_cast<unsigned short>(min<long>(days, MAX_GAME_DAY));
+    }
+
+    // Brak pieniędzy: morale spada o 2 dziennie aż do minimum (game over)
+    const unsigned minimalMorale = m_resourceConstraints.minimal_total_morale;
+    if (m_totalMorale <= minimalMorale)
+        return std::nullopt;
+
+    return static_cast<unsigned short>((m_totalMorale - minimalMorale + 1) / 2);
+}
+
+void ResourcesManager::writeSnapshot(SnapshotWriter &writer) const
+{
+    writer.write(m_personnel.m_total);
+    writer.write(m_personnel.m_working);
+    writer.write(m_personnel.m_hiredInDay);
+    writer.write(m_money);
+    writer.write(m_uranium);
+    writer.write(m_plutonium);
+    writer.write(m_totalMorale);
+    writer.write(m_totalSecurity);
+}
+
+bool ResourcesManager::readSnapshot(SnapshotReader &reader)
+{
+    PersonnelPool::RoleArray total{}, working{}, hiredInDay{};
+    long money = 0;
+    unsigned int uranium = 0, plutonium = 0, morale = 0, security = 0;
+
+    if (!reader.read(total) || !reader.read(working) || !reader.read(hiredInDay) ||
+        !reader.read(money) || !reader.read(uranium) || !reader.read(plutonium) ||
+        !reader.read(morale) || !reader.read(security))
+        return false;
+
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+    {
+        if (working[i] > total[i])
+            return false;
+    }
+
+    m_personnel.m_total = total;
+    m_personnel.m_working = working;
+    m_personnel.m_hiredInDay = hiredInDay;
+    m_money = money;
+    m_uranium = uranium;
+    m_plutonium = plutonium;
+    m_totalMorale = morale;
+    m_totalSecurity = security;
+    return true;
+}
+
 /*
 TODO:
 poprawić i ujednolicić pisownie metod maximum
 zastanowić się jak będzie wyglądał przepływ danych z tego systemu w grze.
-*/
\ No newline at end of file
+*/
@@ -1,9 +1,13 @@
 #pragma once
+#include <optional>
 #include <string>
 #include "../Core/header/TimeSystem.hpp"
 #include "ResourceMissing.hpp"
+#include "ResourceTransaction.hpp"
 #include "ResourceConstraints.hpp"
+#include "PersonnelPool.hpp"
 
+using std::optional;
 using std::shared_ptr;
 using std::string;
 
@@ -12,34 +16,43 @@ class ResourcesManager
 public:
     ResourcesManager(ResourceConstraints &constraints, TimeDataModel &timeSystem);
     ~ResourcesManager() = default;
+    // Generic personnel management (role-indexed)
+    bool hire(PersonnelRole role, unsigned int count);
+    bool fire(PersonnelRole role, unsigned int count);
+    unsigned int getAvailableToHire(PersonnelRole role) const;
+    unsigned int getTotal(PersonnelRole role) const { return m_personnel.m_total[roleIndex(role)]; }
+    unsigned int getWorking(PersonnelRole role) const { return m_personnel.m_working[roleIndex(role)]; }
+    bool setTotal(PersonnelRole role, unsigned int count);
+    unsigned int dailyCost(PersonnelRole role) const;
+    const PersonnelPool &getPersonnel() const { return m_personnel; }
     // Workers management
-    bool hireWorkers(unsigned int count);
-    bool fireWorkers(unsigned int count);
-    unsigned int getAvailableToHireWorkers() const;
-    unsigned int dailyWorkersCost() const;
-    unsigned int tenDaysWorkersCost() const;
-    unsigned int thirtyDaysWorkersCost() const;
+    bool hireWorkers(unsigned int count) { return hire(PersonnelRole::Workers, count); }
+    bool fireWorkers(unsigned int count) { return fire(PersonnelRole::Workers, count); }
+    unsigned int getAvailableToHireWorkers() const { return getAvailableToHire(PersonnelRole::Workers); }
+    unsigned int dailyWorkersCost() const { return dailyCost(PersonnelRole::Workers); }
+    unsigned int tenDaysWorkersCost() const { return dailyWorkersCost() * 10; }
+    unsigned int thirtyDaysWorkersCost() const { return dailyWorkersCost() * 30; }
     // Scientists management
-    bool hireScientists(unsigned int count);
-    bool fireScientists(unsigned int count);
-    unsigned int getAvailableToHireScientists() const;
-    unsigned int dailyScientistsCost() const;
-    unsigned int tenDaysScientistsCost() const;
-    unsigned int thirtyDaysScientistsCost() const;
+    bool hireScientists(unsigned int count) { return hire(PersonnelRole::Scientists, count); }
+    bool fireScientists(unsigned int count) { return fire(PersonnelRole::Scientists, count); }
+    unsigned int getAvailableToHireScientists() const { return getAvailableToHire(PersonnelRole::Scientists); }
+    unsigned int dailyScientistsCost() const { return dailyCost(PersonnelRole::Scientists); }
+    unsigned int tenDaysScientistsCost() const { return dailyScientistsCost() * 10; }
+    unsigned int thirtyDaysScientistsCost() const { return dailyScientistsCost() * 30; }
     // Engineers management
-    bool hireEngineers(unsigned int count);
-    bool fireEngineers(unsigned int count);
-    unsigned int getAvailableToHireEngineers() const;
-    unsigned int dailyEngineersCost() const;
-    unsigned int tenDaysEngineersCost() const;
-    unsigned int thirtyDaysEngineersCost() const;
+    bool hireEngineers(unsigned int count) { return hire(PersonnelRole::Engineers, count); }
+    bool fireEngineers(unsigned int count) { return fire(PersonnelRole::Engineers, count); }
+    unsigned int getAvailableToHireEngineers() const { return getAvailableToHire(PersonnelRole::Engineers); }
+    unsigned int dailyEngineersCost() const { return dailyCost(PersonnelRole::Engineers); }
+    unsigned int tenDaysEngineersCost() const { return dailyEngineersCost() * 10; }
+    unsigned int thirtyDaysEngineersCost() const { return dailyEngineersCost() * 30; }
     // Army Personnel management
-    bool hireArmyPersonnel(unsigned int count);
-    bool fireArmyPersonnel(unsigned int count);
-    unsigned int getAvailableToHireArmyPersonnel() const;
-    unsigned int dailyArmyPersonnelCost() const;
-    unsigned int tenDaysArmyPersonnelCost() const;
-    unsigned int thirtyDaysArmyPersonnelCost() const;
+    bool hireArmyPersonnel(unsigned int count) { return hire(PersonnelRole::ArmyPersonnel, count); }
+    bool fireArmyPersonnel(unsigned int count) { return fire(PersonnelRole::ArmyPersonnel, count); }
+    unsigned int getAvailableToHireArmyPersonnel() const { return getAvailableToHire(PersonnelRole::ArmyPersonnel); }
+    unsigned int dailyArmyPersonnelCost() const { return dailyCost(PersonnelRole::ArmyPersonnel); }
+    unsigned int tenDaysArmyPersonnelCost() const { return dailyArmyPersonnelCost() * 10; }
+    unsigned int thirtyDaysArmyPersonnelCost() const { return dailyArmyPersonnelCost() * 30; }
     // Check total numbers of all personnel
     bool checkTotalNumbersOfAllPersonnel() const;
     // Reset daily hired personnel counts
@@ -48,20 +61,25 @@ public:
     unsigned long dailyPersonnelCost() const;
     unsigned long tenDaysPersonnelCost() const;
     unsigned long thirtyDaysPersonnelCost() const;
+    // Dzienny koszt trwających badań (Technology::m_daylyCost), ustawiany przez ResearchManager.
+    void setResearchDailyCost(long cost) { m_researchDailyCost = cost; }
+    long getResearchDailyCost() const { return m_researchDailyCost; }
+    // Personel + badania - tyle schodzi z salda każdego dnia.
+    long dailyTotalCost() const;
     // Getters for personnel counts
-    unsigned int getTotalWorkers() const;
-    unsigned int getWorkingWorkers() const;
-    unsigned int getTotalScientists() const;
-    unsigned int getWorkingScientists() const;
-    unsigned int getTotalEngineers() const;
-    unsigned int getWorkingEngineers() const;
-    unsigned int getTotalArmyPersonnel() const;
-    unsigned int getWorkingArmyPersonnel() const;
+    unsigned int getTotalWorkers() const { return getTotal(PersonnelRole::Workers); }
+    unsigned int getWorkingWorkers() const { return getWorking(PersonnelRole::Workers); }
+    unsigned int getTotalScientists() const { return getTotal(PersonnelRole::Scientists); }
+    unsigned int getWorkingScientists() const { return getWorking(PersonnelRole::Scientists); }
+    unsigned int getTotalEngineers() const { return getTotal(PersonnelRole::Engineers); }
+    unsigned int getWorkingEngineers() const { return getWorking(PersonnelRole::Engineers); }
+    unsigned int getTotalArmyPersonnel() const { return getTotal(PersonnelRole::ArmyPersonnel); }
+    unsigned int getWorkingArmyPersonnel() const { return getWorking(PersonnelRole::ArmyPersonnel); }
     // Setters for personnel counts
-    bool setTotalWorkers(unsigned int count);
-    bool setTotalScientists(unsigned int count);
-    bool setTotalEngineers(unsigned int count);
-    bool setTotalArmyPersonnel(unsigned int count);
+    bool setTotalWorkers(unsigned int count) { return setTotal(PersonnelRole::Workers, count); }
+    bool setTotalScientists(unsigned int count) { return setTotal(PersonnelRole::Scientists, count); }
+    bool setTotalEngineers(unsigned int count) { return setTotal(PersonnelRole::Engineers, count); }
+    bool setTotalArmyPersonnel(unsigned int count) { return setTotal(PersonnelRole::ArmyPersonnel, count); }
     // Resource stats management
     long getMoney() const;
     bool addMoney(long amount);
@@ -80,33 +98,43 @@ public:
     bool addSecurity(unsigned int amount);
     bool reduceSecurity(unsigned int amount);
     ResourceConstraints &getResourceConstraints() const;
+    // Transakcje: cały pakiet sprawdzany w jednym przejściu względem ResourceConstraints
+    // (dostępni i pracujący każdej roli, saldo po kosztach zatrudnienia, limity budżetu
+    // i surowców), potem zatwierdzany w całości albo odrzucany bez żadnej zmiany stanu.
+    // Zwraca, czego brakuje (same false = transakcja przejdzie).
+    ResourceMissing validateTransaction(const ResourceTransaction &transaction) const;
+    bool applyTransaction(const ResourceTransaction &transaction, ResourceMissing *missing = nullptr);
+    // Dni do najbliższej zmiany trybu dnia (saldo <= 0, morale na minimum)
+    // albo nullopt, gdy przy obecnym stanie nic się nie zmieni.
+    optional<unsigned short> daysUntilNextEvent() const;
+    // Personel, surowce, morale i bezpieczeństwo. Stawki pochodzą z ResourceConstraints,
+    // więc nie są zapisywane. readSnapshot nie zmienia stanu przy błędnych danych.
+    void writeSnapshot(SnapshotWriter &writer) const;
+    bool readSnapshot(SnapshotReader &reader);
 
 private:
-    void onDayPassed(const TimeDataModel &timeModel);
+    // Transakcja po zsumowaniu wpisów: zmiana pracujących per rola i stany końcowe.
+    struct PreparedTransaction
+    {
+        array<long, PERSONNEL_ROLE_COUNT> m_personnel{};
+        long m_money = 0;
+        long m_uranium = 0;
+        long m_plutonium = 0;
+    };
+    bool prepareTransaction(const ResourceTransaction &transaction, PreparedTransaction &prepared,
+                            ResourceMissing &missing) const;
+    // Zbiorczy obserwator czasu: nalicza `count` dni w postaci zamkniętej.
+    void onDaysPassed(const TimeDataModel &timeModel, unsigned short firstDay, unsigned short count);
 
 private:
     ResourceConstraints &m_resourceConstraints;
     TimeDataModel &m_timeModel;
-    shared_ptr<TimeDataModel::DayPassedCallback> m_dayObserverHandle;
-    // Total amount of workerss possible to hire.
-    unsigned int m_totalWorkers;
-    // Currently working workers.
-    unsigned int m_workingWorkers;
-    // Hired workers in the current day. Variable resets at the end of the day.
-    unsigned int m_hiredWorkersInDay;
-    unsigned int m_totalScientists;
-    unsigned int m_workingScientists;
-    // Hired scientists in the current day. Variable resets at the end of the day.
-    unsigned int m_hiredScientistsInDay;
-    unsigned int m_totalEngineers;
-    unsigned int m_workingEngineers;
-    // Hired engineers in the current day. Variable resets at the end of the day.
-    unsigned int m_hiredEngineersInDay;
-
-    unsigned int m_totalArmyPersonnel;
-    unsigned int m_workingArmyPersonnel;
-    // Hired army personnel in the current day. Variable resets at the end of the day.
-    unsigned int m_hiredArmyPersonnelInDay;
+    ObserverSubscription m_daysSubscription;
+    // Personel wszystkich ról (SoA, indeksowany PersonnelRole).
+    // Stawki są kopiowane z ResourceConstraints przy konstrukcji.
+    PersonnelPool m_personnel;
+    // Pochodna stanu badań - nie trafia do snapshotu.
+    long m_researchDailyCost = 0;
 
     // Resource stats
     // If money is negative, m_morale and m_security decrease faster.
@@ -0,0 +1,101 @@
+#include "CampaignScript.hpp"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using std::make_shared;
+using std::max;
+using std::sort;
+using std::uniform_int_distribution;
+
+namespace
+{
+    void hireStaffForAllTechnologies(SimulationWorld &world)
+    {
+        unsigned workers = 0;
+        unsigned scientists = 0;
+        unsigned engineers = 0;
+        unsigned army = 0;
+
+        for (const auto &tech : world.research().getAllTechnologies())
+        {
+            workers = max(workers, tech.m_workersRequired);
+            scientists = max(scientists, tech.m_scientistsRequired);
+            engineers = max(engineers, tech.m_engineersRequired);
+            army = max(army, tech.m_armyPersonnelRequired);
+        }
+
+        ResourceTransaction staffing;
+        staffing.hire(PersonnelRole::Workers, workers)
+            .hire(PersonnelRole::Scientists, scientists)
+            .hire(PersonnelRole::Engineers, engineers)
+            .hire(PersonnelRole::ArmyPersonnel, army);
+        world.resources().applyTransaction(staffing);
+    }
+}
+
+CampaignResult runScriptedCampaign(SimulationWorld &world)
+{
+    CampaignResult result;
+
+    auto &time = world.time();
+    auto &resources = world.resources();
+    auto &research = world.research();
+
+    // Stała kolejność kandydatów (wg id), żeby wynik zależał
+    // wyłącznie od seeda świata, a nie od kolejności w pliku.
+    vector<TechId> techOrder;
+    for (const auto &tech : research.getAllTechnologies())
+        techOrder.push_back(tech.m_index);
+    sort(techOrder.begin(), techOrder.end(), [&](TechId a, TechId b)
+         { return research.getTechnology(a).m_id.str() < research.getTechnology(b).m_id.str(); });
+
+    // Listener żyje tak długo jak świat, więc nie trzyma referencji do `result`.
+    auto completions = make_shared<CampaignResult>();
+    research.addResearchCompletedListener(
+        [completions, &time](const Technology &)
+        {
+            completions->completedTechnologies++;
+            completions->lastCompletionDay = time.currentGameDay();
+        });
+
+    hireStaffForAllTechnologies(world);
+
+    const unsigned minimalMorale = resources.getResourceConstraints().minimal_total_morale;
+    const unsigned short startDay = time.currentGameDay();
+    vector<TechId> candidates;
+
+    while (time.currentGameDay() < MAX_GAME_DAY)
+    {
+        // Zapełnia wolne sloty badań losowymi dostępnymi technologiami,
+        // dopóki starcza wolnego personelu.
+        candidates.clear();
+        for (TechId id : techOrder)
+        {
+            if (research.getTechnology(id).isAvailable())
+                candidates.push_back(id);
+        }
+
+        while (!candidates.empty())
+        {
+            uniform_int_distribution<size_t> pick(0, candidates.size() - 1);
+            const size_t chosen = pick(world.rng());
+            research.startResearch(candidates[chosen]);
+            candidates.erase(candidates.begin() + static_cast<std::ptrdiff_t>(chosen));
+        }
+
+        world.scheduler().runUntilEvent();
+
+        if (resources.getMorale() <= minimalMorale)
+        {
+            result.moraleDepleted = true;
+            break;
+        }
+    }
+
+    result.daysSimulated = time.currentGameDay() - startDay;
+    result.lastCompletionDay = completions->lastCompletionDay;
+    result.completedTechnologies = completions->completedTechnologies;
+    result.finalMoney = resources.getMoney();
+    return result;
+}
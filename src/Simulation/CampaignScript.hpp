@@ -0,0 +1,23 @@
+#pragma once
+#include "SimulationWorld.hpp"
+
+// Wynik jednej rozegranej kampanii.
+struct CampaignResult
+{
+    unsigned short daysSimulated = 0;
+    // Dzień gry, w którym ukończono ostatnie badanie (0 = żadnego).
+    unsigned short lastCompletionDay = 0;
+    unsigned completedTechnologies = 0;
+    long finalMoney = 0;
+    // Morale spadło do minimum -> game over.
+    bool moraleDepleted = false;
+};
+
+// Prosty scenariusz: pierwszego dnia zatrudnia personel wystarczający do
+// każdego badania, a potem po każdym zdarzeniu zapełnia wolne sloty badań
+// losowymi dostępnymi technologiami (z generatora świata), dopóki starcza
+// personelu - aż do MAX_GAME_DAY albo utraty morale.
+// Ten sam seed świata daje zawsze tę samą kampanię.
+// Scenariusz reaguje tylko na zdarzenia, więc czas przesuwa
+// EventHorizonScheduler - wynik jest identyczny jak dzień po dniu.
+CampaignResult runScriptedCampaign(SimulationWorld &world);
@@ -0,0 +1,203 @@
+#include "CommandDispatcher.hpp"
+
+CommandDispatcher::CommandDispatcher(TimeDataModel &time, ResourcesManager &resources, ResearchManager &research)
+    : m_time(time), m_resources(resources), m_research(research)
+{
+}
+
+bool CommandDispatcher::execute(const SimulationCommand &command)
+{
+    SimulationCommand recorded = command;
+    recorded.m_gameDay = m_time.currentGameDay();
+
+    // Checkpoint zapisuje bieżący skrót, zamiast go sprawdzać
+    if (recorded.m_type == CommandType::Checkpoint && m_log != nullptr)
+        recorded.m_value = static_cast<std::int64_t>(stateHash());
+
+    const bool result = apply(recorded);
+
+    if (m_log != nullptr)
+        m_log->append(recorded);
+
+    return result;
+}
+
+bool CommandDispatcher::apply(const SimulationCommand &command)
+{
+    const auto role = static_cast<PersonnelRole>(command.m_role);
+    const auto amount = static_cast<unsigned>(command.m_value);
+
+    switch (command.m_type)
+    {
+    case CommandType::AdvanceDays:
+        // koniec kampanii - bez wyjątku, komenda po prostu nic nie robi
+        if (command.m_value <= 0 || m_time.currentGameDay() + command.m_value > MAX_GAME_DAY)
+            return false;
+        m_time.advanceDays(static_cast<unsigned short>(command.m_value));
+        return true;
+    case CommandType::Hire:
+        return command.m_role < PERSONNEL_ROLE_COUNT && m_resources.hire(role, amount);
+    case CommandType::Fire:
+        return command.m_role < PERSONNEL_ROLE_COUNT && m_resources.fire(role, amount);
+    case CommandType::SetTotal:
+        return command.m_role < PERSONNEL_ROLE_COUNT && m_resources.setTotal(role, amount);
+    case CommandType::AddMoney:
+        return m_resources.addMoney(static_cast<long>(command.m_value));
+    case CommandType::SpendMoney:
+        return m_resources.spendMoney(static_cast<long>(command.m_value));
+    case CommandType::AddUranium:
+        return m_resources.addUranium(amount);
+    case CommandType::SpendUranium:
+        return m_resources.spendUranium(amount);
+    case CommandType::AddPlutonium:
+        return m_resources.addPlutonium(amount);
+    case CommandType::SpendPlutonium:
+        return m_resources.spendPlutonium(amount);
+    case CommandType::AddMorale:
+        return m_resources.addMorale(amount);
+    case CommandType::ReduceMorale:
+        return m_resources.reduceMorale(amount);
+    case CommandType::AddSecurity:
+        return m_resources.addSecurity(amount);
+    case CommandType::ReduceSecurity:
+        return m_resources.reduceSecurity(amount);
+    case CommandType::StartResearch:
+        return m_research.startResearch(command.m_techId);
+    case CommandType::QueueResearch:
+        return m_research.queueResearch(command.m_techId, static_cast<int>(command.m_value));
+    case CommandType::DequeueResearch:
+        return m_research.dequeueResearch(command.m_techId);
+    case CommandType::Checkpoint:
+        return stateHash() == static_cast<std::uint64_t>(command.m_value);
+    case CommandType::TransactionPersonnel:
+        if (command.m_role >= PERSONNEL_ROLE_COUNT)
+            return false;
+        m_pendingTransaction.m_personnel.push_back({role, static_cast<long>(command.m_value)});
+        m_pendingEntries++;
+        return true;
+    case CommandType::TransactionMoney:
+        m_pendingTransaction.m_money += static_cast<long>(command.m_value);
+        m_pendingEntries++;
+        return true;
+    case CommandType::TransactionUranium:
+        m_pendingTransaction.m_uranium += static_cast<long>(command.m_value);
+        m_pendingEntries++;
+        return true;
+    case CommandType::TransactionPlutonium:
+        m_pendingTransaction.m_plutonium += static_cast<long>(command.m_value);
+        m_pendingEntries++;
+        return true;
+    case CommandType::CommitTransaction:
+    {
+        // niekompletny pakiet (np. ucięty log) jest odrzucany w całości
+        const bool complete = m_pendingEntries == command.m_value;
+        const bool result = complete && m_resources.applyTransaction(m_pendingTransaction);
+        m_pendingTransaction.clear();
+        m_pendingEntries = 0;
+        return result;
+    }
+    case CommandType::Count:
+        break;
+    }
+    return false;
+}
+
+SimulationCommand CommandDispatcher::makeCommand(CommandType type, std::int64_t value) const
+{
+    SimulationCommand command;
+    command.m_type = type;
+    command.m_value = value;
+    return command;
+}
+
+bool CommandDispatcher::advanceDays(unsigned short days)
+{
+    return execute(makeCommand(CommandType::AdvanceDays, days));
+}
+
+bool CommandDispatcher::hire(PersonnelRole role, unsigned count)
+{
+    SimulationCommand command = makeCommand(CommandType::Hire, count);
+    command.m_role = static_cast<std::uint8_t>(role);
+    return execute(command);
+}
+
+bool CommandDispatcher::fire(PersonnelRole role, unsigned count)
+{
+    SimulationCommand command = makeCommand(CommandType::Fire, count);
+    command.m_role = static_cast<std::uint8_t>(role);
+    return execute(command);
+}
+
+bool CommandDispatcher::setTotal(PersonnelRole role, unsigned count)
+{
+    SimulationCommand command = makeCommand(CommandType::SetTotal, count);
+    command.m_role = static_cast<std::uint8_t>(role);
+    return execute(command);
+}
+
+bool CommandDispatcher::addMoney(long amount)
+{
+    return execute(makeCommand(CommandType::AddMoney, amount));
+}
+
+bool CommandDispatcher::spendMoney(long amount)
+{
+    return execute(makeCommand(CommandType::SpendMoney, amount));
+}
+
+bool CommandDispatcher::startResearch(TechId techId)
+{
+    SimulationCommand command = makeCommand(CommandType::StartResearch, 0);
+    command.m_techId = techId;
+    return execute(command);
+}
+
+bool CommandDispatcher::queueResearch(TechId techId, int priority)
+{
+    SimulationCommand command = makeCommand(CommandType::QueueResearch, priority);
+    command.m_techId = techId;
+    return execute(command);
+}
+
+bool CommandDispatcher::dequeueResearch(TechId techId)
+{
+    SimulationCommand command = makeCommand(CommandType::DequeueResearch, 0);
+    command.m_techId = techId;
+    return execute(command);
+}
+
+bool CommandDispatcher::applyTransaction(const ResourceTransaction &transaction)
+{
+    std::int64_t entries = 0;
+    auto add = [&](CommandType type, std::int64_t value)
+    {
+        if (value == 0)
+            return;
+        execute(makeCommand(type, value));
+        entries++;
+    };
+
+    for (const auto &entry : transaction.m_personnel)
+    {
+        SimulationCommand command = makeCommand(CommandType::TransactionPersonnel, entry.m_delta);
+        command.m_role = static_cast<std::uint8_t>(entry.m_role);
+        execute(command);
+        entries++;
+    }
+    add(CommandType::TransactionMoney, transaction.m_money);
+    add(CommandType::TransactionUranium, transaction.m_uranium);
+    add(CommandType::TransactionPlutonium, transaction.m_plutonium);
+
+    return execute(makeCommand(CommandType::CommitTransaction, entries));
+}
+
+void CommandDispatcher::checkpoint()
+{
+    execute(makeCommand(CommandType::Checkpoint, 0));
+}
+
+std::uint64_t CommandDispatcher::stateHash() const
+{
+    return computeStateHash(m_time, m_resources, m_research);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include "../Core/header/TimeSystem.hpp"
+#include "../Resources/ResourcesManager.hpp"
+#include "../Research/ResearchManager.hpp"
+#include "CommandLog.hpp"
+
+// Jedyna droga zmiany stanu gry z zewnątrz (UI, skrypty, odtwarzanie logu).
+// Każda komenda jest wykonywana i - jeśli podpięto log - dopisywana do niego
+// razem z dniem gry, w którym ją wydano.
+class CommandDispatcher
+{
+public:
+    CommandDispatcher(TimeDataModel &time, ResourcesManager &resources, ResearchManager &research);
+    ~CommandDispatcher() = default;
+
+    void setLog(CommandLog *log) { m_log = log; }
+
+    // Zwraca wynik wywołanej metody managera (false = nic się nie zmieniło).
+    bool execute(const SimulationCommand &command);
+
+    bool advanceDays(unsigned short days);
+    bool hire(PersonnelRole role, unsigned count);
+    bool fire(PersonnelRole role, unsigned count);
+    bool setTotal(PersonnelRole role, unsigned count);
+    bool addMoney(long amount);
+    bool spendMoney(long amount);
+    bool startResearch(TechId techId);
+    bool queueResearch(TechId techId, int priority = 0);
+    bool dequeueResearch(TechId techId);
+    // Transakcja trafia do logu jako wpisy + zatwierdzenie; wynik jak ResourcesManager::applyTransaction.
+    bool applyTransaction(const ResourceTransaction &transaction);
+    // Zapisuje skrót bieżącego stanu w logu.
+    void checkpoint();
+
+    std::uint64_t stateHash() const;
+
+private:
+    bool apply(const SimulationCommand &command);
+    SimulationCommand makeCommand(CommandType type, std::int64_t value) const;
+
+private:
+    TimeDataModel &m_time;
+    ResourcesManager &m_resources;
+    ResearchManager &m_research;
+    CommandLog *m_log = nullptr;
+    // Wpisy transakcji czekające na CommitTransaction.
+    ResourceTransaction m_pendingTransaction;
+    std::int64_t m_pendingEntries = 0;
+};
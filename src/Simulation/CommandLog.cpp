@@ -0,0 +1,163 @@
+#include "CommandLog.hpp"
+#include <iostream>
+
+using std::cerr;
+using std::ios;
+
+namespace
+{
+    // "MPCL"
+    const constexpr std::uint32_t COMMAND_LOG_MAGIC = 0x4C43504D;
+    const constexpr std::uint16_t COMMAND_LOG_VERSION = 1;
+    const constexpr size_t COMMAND_RECORD_SIZE = 16;
+}
+
+std::uint64_t computeStateHash(const TimeDataModel &time,
+                               const ResourcesManager &resources,
+                               const ResearchManager &research)
+{
+    SnapshotWriter writer;
+    time.writeSnapshot(writer);
+    resources.writeSnapshot(writer);
+    research.writeSnapshot(writer);
+
+    std::uint64_t hash = 1469598103934665603ull;
+    for (byte b : writer.bytes())
+    {
+        hash ^= static_cast<std::uint8_t>(b);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void CommandLog::begin(const ResourceConstraints &constraints,
+                       const TimeDataModel &time,
+                       const ResourcesManager &resources,
+                       const ResearchManager &research)
+{
+    SnapshotWriter writer;
+    constraints.writeBinary(writer);
+    time.writeSnapshot(writer);
+    resources.writeSnapshot(writer);
+    research.writeSnapshot(writer);
+
+    m_initialState = writer.release();
+    m_commands.clear();
+}
+
+bool CommandLog::openFile(const string &path)
+{
+    m_file.close();
+    m_file.open(path, ios::binary | ios::trunc);
+    if (!m_file)
+    {
+        cerr << "Cannot open command log for writing: " << path << "\n";
+        return false;
+    }
+
+    const auto bytes = toBytes();
+    m_file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    m_file.flush();
+    return static_cast<bool>(m_file);
+}
+
+void CommandLog::append(const SimulationCommand &command)
+{
+    m_commands.push_back(command);
+
+    if (!m_file.is_open())
+        return;
+
+    SnapshotWriter writer;
+    writeCommand(writer, command);
+    m_file.write(reinterpret_cast<const char *>(writer.bytes().data()), static_cast<std::streamsize>(writer.bytes().size()));
+    // log ma przetrwać awarię gry - każdy rekord od razu na dysk
+    m_file.flush();
+}
+
+vector<byte> CommandLog::toBytes() const
+{
+    SnapshotWriter writer;
+    writer.write(COMMAND_LOG_MAGIC);
+    writer.write(COMMAND_LOG_VERSION);
+    writer.write(static_cast<std::uint32_t>(m_initialState.size()));
+    for (byte b : m_initialState)
+        writer.write(b);
+
+    for (const auto &command : m_commands)
+        writeCommand(writer, command);
+
+    return writer.release();
+}
+
+bool CommandLog::loadFromBytes(span<const byte> bytes)
+{
+    SnapshotReader reader(bytes);
+    std::uint32_t magic = 0;
+    std::uint16_t version = 0;
+    std::uint32_t initialSize = 0;
+    if (!reader.read(magic) || !reader.read(version) || !reader.read(initialSize))
+        return false;
+
+    if (magic != COMMAND_LOG_MAGIC || version != COMMAND_LOG_VERSION || initialSize > reader.remaining())
+        return false;
+
+    const size_t headerSize = bytes.size() - reader.remaining();
+    vector<byte> initialState(bytes.begin() + headerSize, bytes.begin() + headerSize + initialSize);
+
+    SnapshotReader records(bytes.subspan(headerSize + initialSize));
+    vector<SimulationCommand> commands;
+    while (records.remaining() >= COMMAND_RECORD_SIZE)
+    {
+        SimulationCommand command;
+        std::uint8_t type = 0;
+        records.read(type);
+        records.read(command.m_role);
+        records.read(command.m_gameDay);
+        records.read(command.m_techId);
+        records.read(command.m_value);
+
+        if (type >= static_cast<std::uint8_t>(CommandType::Count))
+            return false;
+        command.m_type = static_cast<CommandType>(type);
+        commands.push_back(command);
+    }
+
+    m_initialState = std::move(initialState);
+    m_commands = std::move(commands);
+    return true;
+}
+
+bool CommandLog::loadFromFile(const string &path)
+{
+    vector<byte> bytes;
+    return loadSnapshotFile(path, bytes) && loadFromBytes(bytes);
+}
+
+bool CommandLog::readConstraints(ResourceConstraints &constraints) const
+{
+    SnapshotReader reader(m_initialState);
+    return constraints.readBinary(reader);
+}
+
+bool CommandLog::restoreInitialState(TimeDataModel &time,
+                                     ResourcesManager &resources,
+                                     ResearchManager &research) const
+{
+    SnapshotReader reader(m_initialState);
+    ResourceConstraints skipped;
+    return skipped.readBinary(reader) &&
+           time.readSnapshot(reader) &&
+           resources.readSnapshot(reader) &&
+           research.readSnapshot(reader) &&
+           reader.atEnd();
+}
+
+void CommandLog::writeCommand(SnapshotWriter &writer, const SimulationCommand &command)
+{
+    writer.write(static_cast<std::uint8_t>(command.m_type));
+    writer.write(command.m_role);
+    writer.write(command.m_gameDay);
+    writer.write(command.m_techId);
+    writer.write(command.m_value);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+#include "../Core/header/Snapshot.hpp"
+#include "../Core/header/TimeSystem.hpp"
+#include "../Resources/ResourceConstraints.hpp"
+#include "../Resources/ResourcesManager.hpp"
+#include "../Research/ResearchManager.hpp"
+
+using std::ofstream;
+using std::span;
+using std::string;
+using std::vector;
+
+// Każda komenda zmieniająca stan gry. Wartości są zapisywane w logu -
+// nie zmieniać istniejących, tylko dopisywać na końcu.
+enum class CommandType : std::uint8_t
+{
+    AdvanceDays,
+    Hire,
+    Fire,
+    SetTotal,
+    AddMoney,
+    SpendMoney,
+    AddUranium,
+    SpendUranium,
+    AddPlutonium,
+    SpendPlutonium,
+    AddMorale,
+    ReduceMorale,
+    AddSecurity,
+    ReduceSecurity,
+    StartResearch,
+    QueueResearch,
+    DequeueResearch,
+    // Skrót stanu w tym miejscu logu (m_value) - sprawdzany przy odtwarzaniu.
+    Checkpoint,
+    // Transakcja zasobów: wpisy (m_role + m_value ze znakiem) zbierane przez dispatcher,
+    // zatwierdzane razem przez CommitTransaction (m_value = liczba wpisów).
+    TransactionPersonnel,
+    TransactionMoney,
+    TransactionUranium,
+    TransactionPlutonium,
+    CommitTransaction,
+    Count
+};
+
+// Rekord logu: stałe 16 bajtów.
+struct SimulationCommand
+{
+    CommandType m_type = CommandType::AdvanceDays;
+    // PersonnelRole dla Hire/Fire/SetTotal/TransactionPersonnel
+    std::uint8_t m_role = 0;
+    // Dzień gry, w którym komendę wydano (kontrola rozjazdu przy odtwarzaniu).
+    unsigned short m_gameDay = 0;
+    TechId m_techId = INVALID_TECH_ID;
+    // Ilość / liczba dni / priorytet kolejki / skrót stanu
+    std::int64_t m_value = 0;
+};
+
+// FNV-1a po snapshotach czasu, zasobów i badań.
+std::uint64_t computeStateHash(const TimeDataModel &time,
+                               const ResourcesManager &resources,
+                               const ResearchManager &research);
+
+// Log komend: nagłówek ze stanem początkowym (stałe zasobów + snapshot świata),
+// potem rekordy dopisywane na końcu pliku. Ucięty ostatni rekord (np. po awarii)
+// jest przy wczytywaniu pomijany.
+class CommandLog
+{
+public:
+    CommandLog() = default;
+    ~CommandLog() = default;
+
+    CommandLog(const CommandLog &) = delete;
+    CommandLog &operator=(const CommandLog &) = delete;
+
+    // Zapamiętuje stan początkowy i czyści komendy.
+    void begin(const ResourceConstraints &constraints,
+               const TimeDataModel &time,
+               const ResourcesManager &resources,
+               const ResearchManager &research);
+    // Od teraz każdy append trafia też do pliku (nagłówek + dotychczasowe komendy od razu).
+    bool openFile(const string &path);
+    void append(const SimulationCommand &command);
+
+    const vector<SimulationCommand> &commands() const { return m_commands; }
+    vector<byte> toBytes() const;
+    bool loadFromBytes(span<const byte> bytes);
+    bool loadFromFile(const string &path);
+
+    // Odtworzenie stanu początkowego: najpierw stałe (przed konstrukcją managerów),
+    // potem stan dynamiczny.
+    bool readConstraints(ResourceConstraints &constraints) const;
+    bool restoreInitialState(TimeDataModel &time,
+                             ResourcesManager &resources,
+                             ResearchManager &research) const;
+
+private:
+    static void writeCommand(SnapshotWriter &writer, const SimulationCommand &command);
+
+private:
+    // stałe zasobów + snapshot czasu, zasobów i badań
+    vector<byte> m_initialState;
+    vector<SimulationCommand> m_commands;
+    ofstream m_file;
+};
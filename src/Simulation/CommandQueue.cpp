@@ -0,0 +1,94 @@
+#include "CommandQueue.hpp"
+
+namespace
+{
+    SimulationCommand makeCommand(CommandType type, std::int64_t value)
+    {
+        SimulationCommand command;
+        command.m_type = type;
+        command.m_value = value;
+        return command;
+    }
+}
+
+bool CommandQueue::submit(const SimulationCommand &command)
+{
+    if (!m_commands.tryPush(command))
+        return false;
+
+    wake();
+    return true;
+}
+
+bool CommandQueue::advanceDays(unsigned short days)
+{
+    return submit(makeCommand(CommandType::AdvanceDays, days));
+}
+
+bool CommandQueue::hire(PersonnelRole role, unsigned count)
+{
+    SimulationCommand command = makeCommand(CommandType::Hire, count);
+    command.m_role = static_cast<std::uint8_t>(role);
+    return submit(command);
+}
+
+bool CommandQueue::fire(PersonnelRole role, unsigned count)
+{
+    SimulationCommand command = makeCommand(CommandType::Fire, count);
+    command.m_role = static_cast<std::uint8_t>(role);
+    return submit(command);
+}
+
+bool CommandQueue::addMoney(long amount)
+{
+    return submit(makeCommand(CommandType::AddMoney, amount));
+}
+
+bool CommandQueue::spendMoney(long amount)
+{
+    return submit(makeCommand(CommandType::SpendMoney, amount));
+}
+
+bool CommandQueue::startResearch(TechId techId)
+{
+    SimulationCommand command = makeCommand(CommandType::StartResearch, 0);
+    command.m_techId = techId;
+    return submit(command);
+}
+
+bool CommandQueue::queueResearch(TechId techId, int priority)
+{
+    SimulationCommand command = makeCommand(CommandType::QueueResearch, priority);
+    command.m_techId = techId;
+    return submit(command);
+}
+
+bool CommandQueue::dequeueResearch(TechId techId)
+{
+    SimulationCommand command = makeCommand(CommandType::DequeueResearch, 0);
+    command.m_techId = techId;
+    return submit(command);
+}
+
+void CommandQueue::wake()
+{
+    m_signals.fetch_add(1, std::memory_order_release);
+    m_signals.notify_one();
+}
+
+size_t CommandQueue::drain(CommandDispatcher &dispatcher)
+{
+    size_t count = 0;
+    SimulationCommand command;
+    while (m_commands.tryPop(command))
+    {
+        dispatcher.execute(command);
+        count++;
+    }
+    return count;
+}
+
+void CommandQueue::waitForWork(std::uint32_t seen) const
+{
+    m_signals.wait(seen, std::memory_order_acquire);
+}
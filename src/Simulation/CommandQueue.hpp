@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "../Core/header/SpscQueue.hpp"
+#include "CommandDispatcher.hpp"
+
+// Komendy z wątku UI do wątku symulacji (SPSC, bez blokad).
+// Metody producenta mają te same nazwy co CommandDispatcher, ale tylko kolejkują:
+// wynik (czy zmieniło stan) nie jest znany UI - widać go w następnym widoku stanu.
+// false = kolejka pełna, komenda odrzucona.
+class CommandQueue
+{
+public:
+    static const constexpr size_t CAPACITY = 256;
+
+    CommandQueue() = default;
+
+    CommandQueue(const CommandQueue &) = delete;
+    CommandQueue &operator=(const CommandQueue &) = delete;
+
+    // --- wątek UI ---
+    bool submit(const SimulationCommand &command);
+    bool advanceDays(unsigned short days);
+    bool hire(PersonnelRole role, unsigned count);
+    bool fire(PersonnelRole role, unsigned count);
+    bool addMoney(long amount);
+    bool spendMoney(long amount);
+    bool startResearch(TechId techId);
+    bool queueResearch(TechId techId, int priority = 0);
+    bool dequeueResearch(TechId techId);
+
+    // Budzi konsumenta czekającego w waitForWork (np. po zmianie prędkości gry).
+    void wake();
+
+    // --- wątek symulacji ---
+    // Wykonuje wszystkie czekające komendy; zwraca ich liczbę.
+    size_t drain(CommandDispatcher &dispatcher);
+    // Licznik zgłoszeń (komendy + wake) - do porównania w waitForWork.
+    std::uint32_t signalCount() const { return m_signals.load(std::memory_order_acquire); }
+    // Śpi (bez odpytywania), dopóki signalCount() == seen.
+    void waitForWork(std::uint32_t seen) const;
+
+private:
+    SpscQueue<SimulationCommand, CAPACITY> m_commands;
+    std::atomic<std::uint32_t> m_signals{0};
+};
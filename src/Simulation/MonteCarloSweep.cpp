@@ -0,0 +1,130 @@
+#include "MonteCarloSweep.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "CampaignScript.hpp"
+#include "SimulationWorld.hpp"
+#include "WorkStealingPool.hpp"
+
+using std::accumulate;
+using std::floor;
+using std::min;
+
+namespace
+{
+    // SplitMix64 - rozprasza kolejne numery kampanii na niezależne seedy.
+    unsigned long long campaignSeed(unsigned long long baseSeed, unsigned long long campaign)
+    {
+        unsigned long long z = baseSeed + (campaign + 1) * 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+// =====================================================
+// HISTOGRAM
+// =====================================================
+Histogram::Histogram(double min, double max, unsigned bins)
+    : m_min(min), m_max(max), m_counts(bins == 0 ? 1 : bins, 0)
+{
+}
+
+void Histogram::add(double value)
+{
+    if (value < m_min)
+    {
+        m_underflow++;
+        return;
+    }
+    if (value >= m_max)
+    {
+        m_overflow++;
+        return;
+    }
+
+    size_t bin = static_cast<size_t>(floor((value - m_min) / binWidth()));
+    m_counts[min(bin, m_counts.size() - 1)]++;
+}
+
+void Histogram::merge(const Histogram &other)
+{
+    for (size_t i = 0; i < m_counts.size() && i < other.m_counts.size(); ++i)
+        m_counts[i] += other.m_counts[i];
+
+    m_underflow += other.m_underflow;
+    m_overflow += other.m_overflow;
+}
+
+unsigned long Histogram::total() const
+{
+    return accumulate(m_counts.begin(), m_counts.end(), m_underflow + m_overflow);
+}
+
+// =====================================================
+// SWEEP
+// =====================================================
+SweepResult::SweepResult(const SweepConfig &config)
+    : finalCompletionDay(MIN_GAME_DAY, MAX_GAME_DAY + 1, 61),
+      finalMoney(config.moneyHistogramMin, config.moneyHistogramMax, 60)
+{
+}
+
+void SweepResult::merge(const SweepResult &other)
+{
+    campaigns += other.campaigns;
+    moraleGameOvers += other.moraleGameOvers;
+    allResearchCompleted += other.allResearchCompleted;
+    finalCompletionDay.merge(other.finalCompletionDay);
+    finalMoney.merge(other.finalMoney);
+}
+
+SweepResult runMonteCarloSweep(const ResourceConstraints &constraints,
+                               const vector<Technology> &technologies,
+                               const SweepConfig &config)
+{
+    const unsigned long perTask = config.campaignsPerTask == 0 ? 1 : config.campaignsPerTask;
+    const unsigned long taskCount = (config.campaigns + perTask - 1) / perTask;
+
+    // Jeden wynik cząstkowy na zadanie - wątki nie dzielą żadnego stanu.
+    vector<SweepResult> partials(taskCount, SweepResult(config));
+
+    {
+        WorkStealingPool pool(config.threads);
+
+        for (unsigned long task = 0; task < taskCount; ++task)
+        {
+            pool.submit([&, task]
+            {
+                SweepResult &local = partials[task];
+                const unsigned long begin = task * perTask;
+                const unsigned long end = min(config.campaigns, begin + perTask);
+
+                for (unsigned long campaign = begin; campaign < end; ++campaign)
+                {
+                    SimulationWorld world(constraints, technologies,
+                                          campaignSeed(config.seed, campaign), config.outcomeMode);
+                    CampaignResult outcome = runScriptedCampaign(world);
+
+                    local.campaigns++;
+                    if (outcome.moraleDepleted)
+                        local.moraleGameOvers++;
+                    if (outcome.completedTechnologies == technologies.size())
+                    {
+                        local.allResearchCompleted++;
+                        local.finalCompletionDay.add(outcome.lastCompletionDay);
+                    }
+                    local.finalMoney.add(static_cast<double>(outcome.finalMoney));
+                }
+            });
+        }
+
+        pool.wait();
+    }
+
+    SweepResult result(config);
+    for (const auto &partial : partials)
+        result.merge(partial);
+    return result;
+}
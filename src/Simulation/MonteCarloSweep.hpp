@@ -0,0 +1,64 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "../Core/header/TimeSystem.hpp"
+#include "../Resources/ResourceConstraints.hpp"
+#include "../Research/ResearchManager.hpp"
+
+using std::string;
+using std::vector;
+
+// Histogram o stałych przedziałach. Wartości spoza [min, max) trafiają
+// do m_underflow / m_overflow.
+struct Histogram
+{
+    Histogram(double min, double max, unsigned bins);
+
+    void add(double value);
+    void merge(const Histogram &other);
+    double binWidth() const { return (m_max - m_min) / m_counts.size(); }
+    unsigned long total() const;
+
+    double m_min;
+    double m_max;
+    vector<unsigned long> m_counts;
+    unsigned long m_underflow = 0;
+    unsigned long m_overflow = 0;
+};
+
+struct SweepConfig
+{
+    unsigned long campaigns = 10000;
+    // 0 -> liczba rdzeni
+    unsigned threads = 0;
+    unsigned long long seed = 1;
+    // Randomized: czasy i porażki badań losowane z seeda kampanii.
+    ResearchOutcomeMode outcomeMode = ResearchOutcomeMode::Deterministic;
+    // Tyle kampanii wykonuje jedno zadanie puli (mniej synchronizacji).
+    unsigned long campaignsPerTask = 64;
+    long moneyHistogramMin = -5000000;
+    long moneyHistogramMax = 10000000;
+};
+
+struct SweepResult
+{
+    explicit SweepResult(const SweepConfig &config);
+
+    void merge(const SweepResult &other);
+
+    unsigned long campaigns = 0;
+    unsigned long moraleGameOvers = 0;
+    // Kampanie, w których ukończono wszystkie technologie.
+    unsigned long allResearchCompleted = 0;
+    // Dzień ukończenia ostatniej technologii (tylko gdy ukończono wszystkie).
+    Histogram finalCompletionDay;
+    Histogram finalMoney;
+};
+
+// Rozgrywa config.campaigns niezależnych kampanii (runScriptedCampaign)
+// równolegle na WorkStealingPool. Każda kampania ma własny świat i seed
+// wyprowadzony z config.seed i numeru kampanii, więc wynik nie zależy
+// od liczby wątków. `technologies` jest tylko czytane.
+SweepResult runMonteCarloSweep(const ResourceConstraints &constraints,
+                               const vector<Technology> &technologies,
+                               const SweepConfig &config);
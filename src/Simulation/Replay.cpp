@@ -0,0 +1,61 @@
+#include "Replay.hpp"
+#include <string>
+#include "CommandDispatcher.hpp"
+#include "SimulationWorld.hpp"
+
+ReplayResult replayCommandLog(const CommandLog &log, const vector<Technology> &technologies)
+{
+    ReplayResult result;
+
+    ResourceConstraints constraints;
+    if (!log.readConstraints(constraints))
+    {
+        result.desynced = true;
+        result.error = "Invalid resource constraints in log header";
+        return result;
+    }
+
+    SimulationWorld world(constraints, technologies);
+    if (!log.restoreInitialState(world.time(), world.resources(), world.research()))
+    {
+        result.desynced = true;
+        result.error = "Initial state in log header does not match technologies";
+        return result;
+    }
+
+    CommandDispatcher dispatcher(world.time(), world.resources(), world.research());
+    const auto &commands = log.commands();
+
+    for (size_t i = 0; i < commands.size(); ++i)
+    {
+        const SimulationCommand &command = commands[i];
+
+        if (command.m_gameDay != world.time().currentGameDay())
+        {
+            result.desynced = true;
+            result.failedCommand = i;
+            result.error = "Command " + std::to_string(i) + " recorded on day " + std::to_string(command.m_gameDay) +
+                           ", replayed on day " + std::to_string(world.time().currentGameDay());
+            break;
+        }
+
+        const bool applied = dispatcher.execute(command);
+        result.commandsExecuted++;
+
+        if (command.m_type == CommandType::Checkpoint)
+        {
+            if (!applied)
+            {
+                result.desynced = true;
+                result.failedCommand = i;
+                result.error = "State hash mismatch at checkpoint " + std::to_string(i) +
+                               " (day " + std::to_string(command.m_gameDay) + ")";
+                break;
+            }
+            result.checkpointsVerified++;
+        }
+    }
+
+    result.finalHash = dispatcher.stateHash();
+    return result;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CommandLog.hpp"
+
+using std::string;
+using std::vector;
+
+struct ReplayResult
+{
+    size_t commandsExecuted = 0;
+    size_t checkpointsVerified = 0;
+    // Pierwsza niezgodność (zły dzień albo skrót w checkpoincie) przerywa odtwarzanie.
+    bool desynced = false;
+    size_t failedCommand = 0;
+    string error;
+    std::uint64_t finalHash = 0;
+};
+
+// Odtwarza log w świecie headless z pełną prędkością: stałe i stan początkowy z nagłówka,
+// technologie z `technologies` (muszą być tymi samymi danymi, co przy nagraniu).
+ReplayResult replayCommandLog(const CommandLog &log, const vector<Technology> &technologies);
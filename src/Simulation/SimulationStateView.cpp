@@ -0,0 +1,99 @@
+#include "SimulationStateView.hpp"
+
+StateViewPublisher::StateViewPublisher(const TimeDataModel &time, const ResourcesManager &resources,
+                                       const ResearchManager &research)
+    : m_time(time),
+      m_resources(resources),
+      m_research(research)
+{
+    // wywoływane na wątku symulacji, tak jak publish()
+    m_researchSubscription = m_research.subscribeStateChanged([this](TechId)
+                                                              { m_researchVersion++; });
+}
+
+void StateViewPublisher::publish()
+{
+    SimulationStateView &view = m_buffers.writeBuffer();
+    fill(view);
+    m_buffers.publish();
+    m_publishedKey = currentKey();
+}
+
+bool StateViewPublisher::publishIfChanged()
+{
+    if (m_version != 0 && currentKey() == m_publishedKey)
+        return false;
+
+    publish();
+    return true;
+}
+
+StateViewPublisher::StateKey StateViewPublisher::currentKey() const
+{
+    StateKey key;
+    key.m_gameDay = m_time.currentGameDay();
+    key.m_researchVersion = m_researchVersion;
+    key.m_graphVersion = m_research.getGraphVersion();
+    key.m_money = m_resources.getMoney();
+    key.m_uranium = m_resources.getUranium();
+    key.m_plutonium = m_resources.getPlutonium();
+    key.m_morale = m_resources.getMorale();
+    key.m_security = m_resources.getSecurity();
+    key.m_totalPersonnel = m_resources.getPersonnel().m_total;
+    key.m_workingPersonnel = m_resources.getPersonnel().m_working;
+    key.m_queueVersion = m_research.getQueueVersion();
+    key.m_outcomeMode = m_research.getOutcomeMode();
+    return key;
+}
+
+void StateViewPublisher::fill(SimulationStateView &view)
+{
+    view.m_version = ++m_version;
+    view.m_researchVersion = m_researchVersion;
+    view.m_graphVersion = m_research.getGraphVersion();
+    view.m_tickMs = m_tickMs;
+
+    // czas
+    view.m_date = m_time.currentDate();
+    view.m_gameDay = m_time.currentGameDay();
+    view.m_dayOfWeek = m_time.currentDayOfWeek();
+
+    // zasoby
+    view.m_money = m_resources.getMoney();
+    view.m_uranium = m_resources.getUranium();
+    view.m_plutonium = m_resources.getPlutonium();
+    view.m_morale = m_resources.getMorale();
+    view.m_security = m_resources.getSecurity();
+    view.m_totalPersonnel = m_resources.getPersonnel().m_total;
+    view.m_workingPersonnel = m_resources.getPersonnel().m_working;
+    view.m_dailyCost = m_resources.dailyTotalCost();
+    view.m_researchDailyCost = m_resources.getResearchDailyCost();
+
+    BudgetForecast forecast(m_resources);
+    m_research.addResearchCosts(forecast);
+    view.m_forecastSummary = forecast.project(FORECAST_DAYS);
+    forecast.projectSeries(FORECAST_DAYS, view.m_forecast);
+
+    // badania
+    const auto &techs = m_research.getAllTechnologies();
+    view.m_techs.resize(techs.size());
+    for (size_t i = 0; i < techs.size(); ++i)
+        view.m_techs[i] = TechStateView{techs[i].m_state, techs[i].m_progressDays, techs[i].m_researchDays};
+    // trwające: czas próby ze slotu (w trybie losowym wylosowany, różny od danych)
+    for (const auto &slot : m_research.getActiveResearches())
+        view.m_techs[slot.m_techId].m_researchDays = slot.m_researchDays;
+
+    view.m_activeResearch.assign(m_research.getActiveResearches().begin(), m_research.getActiveResearches().end());
+    view.m_researchQueue.assign(m_research.getResearchQueue().begin(), m_research.getResearchQueue().end());
+    view.m_outcomeMode = m_research.getOutcomeMode();
+
+    if (m_estimatesDay != view.m_gameDay || m_estimatesResearchVersion != m_researchVersion ||
+        m_estimatesMode != view.m_outcomeMode)
+    {
+        m_estimates = m_research.estimateAllCompletions();
+        m_estimatesDay = view.m_gameDay;
+        m_estimatesResearchVersion = m_researchVersion;
+        m_estimatesMode = view.m_outcomeMode;
+    }
+    view.m_estimates.assign(m_estimates.begin(), m_estimates.end());
+}
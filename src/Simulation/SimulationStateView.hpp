@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "../Core/header/TimeSystem.hpp"
+#include "../Core/header/TripleBuffer.hpp"
+#include "../Resources/BudgetForecast.hpp"
+#include "../Resources/ResourcesManager.hpp"
+#include "../Research/ResearchManager.hpp"
+
+using std::vector;
+
+// Stan dynamiczny jednej technologii (indeks == TechId).
+struct TechStateView
+{
+    ResearchState m_state = ResearchState::Locked;
+    unsigned m_progressDays = 0;
+    unsigned m_researchDays = 0;
+
+    bool isAvailable() const { return m_state == ResearchState::Available; }
+    bool isInProgress() const { return m_state == ResearchState::InProgress; }
+    bool isCompleted() const { return m_state == ResearchState::Completed; }
+    bool isLocked() const { return m_state == ResearchState::Locked; }
+    float progress() const { return m_researchDays ? float(m_progressDays) / float(m_researchDays) : 0.f; }
+};
+
+// Niezmienny obraz stanu symulacji z jednej chwili - to, co czytają HUD-y.
+// Dane statyczne technologii (nazwy, opisy, graf) nie zmieniają się po wczytaniu
+// i są czytane wprost z ResearchManager; tu trafia tylko to, co zmienia tick.
+struct SimulationStateView
+{
+    // Numer publikacji (0 = jeszcze nic nie opublikowano).
+    std::uint64_t m_version = 0;
+    // Zmienia się tylko, gdy zmienił się stan którejś technologii (start, koniec,
+    // porażka, wczytanie) - widoki mogą po nim unieważniać własne cache.
+    std::uint64_t m_researchVersion = 0;
+    // ResearchManager::getGraphVersion() - zmiana oznacza nowe dane statyczne technologii.
+    std::uint64_t m_graphVersion = 0;
+
+    // czas
+    DateModel m_date;
+    unsigned short m_gameDay = MIN_GAME_DAY;
+    DayOfWeek m_dayOfWeek = DayOfWeek::MONDAY;
+
+    // zasoby
+    long m_money = 0;
+    unsigned int m_uranium = 0;
+    unsigned int m_plutonium = 0;
+    unsigned int m_morale = 0;
+    unsigned int m_security = 0;
+    PersonnelPool::RoleArray m_totalPersonnel{};
+    PersonnelPool::RoleArray m_workingPersonnel{};
+    long m_dailyCost = 0;
+    long m_researchDailyCost = 0;
+
+    // prognoza budżetu (liczona po stronie symulacji)
+    vector<BudgetLevels> m_forecast;
+    BudgetForecastSummary m_forecastSummary;
+
+    // badania
+    vector<TechStateView> m_techs;
+    vector<ActiveResearch> m_activeResearch;
+    vector<QueuedResearch> m_researchQueue;
+    vector<ResearchEstimate> m_estimates;
+    ResearchOutcomeMode m_outcomeMode = ResearchOutcomeMode::Deterministic;
+
+    // ostatni krok wątku symulacji (komendy + dni) - sekcja "Simulation tick" w profilerze
+    float m_tickMs = 0.f;
+
+    unsigned int availableToHire(PersonnelRole role) const
+    {
+        const size_t i = roleIndex(role);
+        return m_totalPersonnel[i] - m_workingPersonnel[i];
+    }
+};
+
+// Publikacja widoków stanu: wątek symulacji wywołuje publish() raz na tick,
+// wątek renderowania czyta acquire() bez blokad (potrójny bufor).
+// Tablice stanu wypełniane są w pojemności poprzednich buforów; ETA przeliczane jest
+// tylko przy zmianie dnia lub stanu badań.
+class StateViewPublisher
+{
+public:
+    static const constexpr unsigned short FORECAST_DAYS = 365;
+
+    StateViewPublisher(const TimeDataModel &time, const ResourcesManager &resources, const ResearchManager &research);
+    ~StateViewPublisher() = default;
+
+    StateViewPublisher(const StateViewPublisher &) = delete;
+    StateViewPublisher &operator=(const StateViewPublisher &) = delete;
+
+    // Wątek symulacji.
+    void publish();
+    // Publikuje tylko, gdy zmienił się stan (dzień, zasoby, badania) - inaczej
+    // czytelnik nie dostaje świeżego widoku i nie musi nic przerysowywać.
+    bool publishIfChanged();
+    std::uint64_t publishedVersion() const { return m_version; }
+    // Czas ostatniego kroku symulacji - trafia do następnego widoku (sam nie wymusza publikacji).
+    void setTickTime(float ms) { m_tickMs = ms; }
+
+    // Wątek renderowania: najnowszy widok, ważny do następnego acquire().
+    const SimulationStateView &acquire() { return m_buffers.read(); }
+    bool hasFresh() const { return m_buffers.hasFresh(); }
+
+private:
+    // Odcisk stanu z wartości skalarnych: postęp badań zmienia się tylko z dniem,
+    // stan technologii - z wersją badań.
+    struct StateKey
+    {
+        unsigned short m_gameDay = 0;
+        std::uint64_t m_researchVersion = 0;
+        std::uint64_t m_graphVersion = 0;
+        long m_money = 0;
+        unsigned int m_uranium = 0;
+        unsigned int m_plutonium = 0;
+        unsigned int m_morale = 0;
+        unsigned int m_security = 0;
+        PersonnelPool::RoleArray m_totalPersonnel{};
+        PersonnelPool::RoleArray m_workingPersonnel{};
+        std::uint64_t m_queueVersion = 0;
+        ResearchOutcomeMode m_outcomeMode = ResearchOutcomeMode::Deterministic;
+
+        bool operator==(const StateKey &) const = default;
+    };
+
+    StateKey currentKey() const;
+    void fill(SimulationStateView &view);
+
+private:
+    const TimeDataModel &m_time;
+    const ResourcesManager &m_resources;
+    const ResearchManager &m_research;
+    ObserverSubscription m_researchSubscription;
+
+    TripleBuffer<SimulationStateView> m_buffers;
+    std::uint64_t m_version = 0;
+    std::uint64_t m_researchVersion = 1;
+    StateKey m_publishedKey;
+    float m_tickMs = 0.f;
+    // ETA ostatniego przeliczenia (kopiowane do kolejnych buforów).
+    vector<ResearchEstimate> m_estimates;
+    unsigned short m_estimatesDay = 0;
+    std::uint64_t m_estimatesResearchVersion = 0;
+    ResearchOutcomeMode m_estimatesMode = ResearchOutcomeMode::Deterministic;
+};
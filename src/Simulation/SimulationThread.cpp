@@ -0,0 +1,188 @@
+#include "SimulationThread.hpp"
+#include <algorithm>
+
+namespace
+{
+    double daysPerSecond(GameSpeed speed)
+    {
+        switch (speed)
+        {
+        case GameSpeed::OneDayPerSecond:
+            return 1.0;
+        case GameSpeed::TenDaysPerSecond:
+            return 10.0;
+        default:
+            return 0.0;
+        }
+    }
+}
+
+const char *gameSpeedName(GameSpeed speed)
+{
+    switch (speed)
+    {
+    case GameSpeed::Paused:
+        return "Paused";
+    case GameSpeed::OneDayPerSecond:
+        return "1 day/s";
+    case GameSpeed::TenDaysPerSecond:
+        return "10 days/s";
+    case GameSpeed::Max:
+        return "Max";
+    default:
+        return "?";
+    }
+}
+
+SimulationThread::SimulationThread(TimeDataModel &time,
+                                   ResearchManager &research,
+                                   CommandDispatcher &dispatcher,
+                                   CommandQueue &commands,
+                                   StateViewPublisher &publisher)
+    : m_time(time),
+      m_dispatcher(dispatcher),
+      m_commands(commands),
+      m_publisher(publisher)
+{
+    // listenery wołane tam, gdzie zmienia się stan - po start() na wątku symulacji
+    research.addResearchCompletedListener(
+        [this](const Technology &tech)
+        {
+            SimulationEvent event;
+            event.m_type = SimulationEventType::ResearchCompleted;
+            event.m_techId = tech.m_index;
+            pushEvent(event);
+        });
+    research.addResearchMissingResourcesListener(
+        [this](const ResourceMissing &missing)
+        {
+            SimulationEvent event;
+            event.m_type = SimulationEventType::ResearchMissingResources;
+            event.m_missing = missing;
+            pushEvent(event);
+        });
+}
+
+SimulationThread::~SimulationThread()
+{
+    stop();
+}
+
+void SimulationThread::start()
+{
+    if (m_running.exchange(true))
+        return;
+
+    m_thread = std::thread([this] { run(); });
+}
+
+void SimulationThread::stop()
+{
+    if (!m_running.exchange(false))
+        return;
+
+    m_commands.wake();
+    m_thread.join();
+}
+
+void SimulationThread::setSpeed(GameSpeed speed)
+{
+    m_speed.store(speed, std::memory_order_release);
+    m_commands.wake();
+}
+
+void SimulationThread::run()
+{
+    m_lastTick = Clock::now();
+
+    while (m_running.load(std::memory_order_acquire))
+    {
+        const std::uint32_t seen = m_commands.signalCount();
+        const Clock::time_point tickStart = Clock::now();
+        m_commands.drain(m_dispatcher);
+
+        const GameSpeed speed = m_speed.load(std::memory_order_acquire);
+        advance(speed);
+        m_publisher.setTickTime(std::chrono::duration<float, std::milli>(Clock::now() - tickStart).count());
+
+        if (m_publisher.publishIfChanged() && m_onPublished)
+            m_onPublished();
+
+        if (speed == GameSpeed::Paused)
+        {
+            m_commands.waitForWork(seen);
+            // czas pauzy nie może zamienić się w zaległe dni
+            m_lastTick = Clock::now();
+        }
+        else if (speed != GameSpeed::Max)
+        {
+            std::this_thread::sleep_for(TICK_SLICE);
+        }
+    }
+}
+
+void SimulationThread::advance(GameSpeed speed)
+{
+    const Clock::time_point now = Clock::now();
+    const Clock::duration elapsed = now - m_lastTick;
+    m_lastTick = now;
+
+    const unsigned short remaining = MAX_GAME_DAY - m_time.currentGameDay();
+    if (speed != GameSpeed::Paused && remaining == 0)
+    {
+        campaignEnded();
+        return;
+    }
+
+    switch (speed)
+    {
+    case GameSpeed::Paused:
+        m_dayDebt = 0.0;
+        return;
+
+    case GameSpeed::Max:
+    {
+        // partiami do następnej publikacji - komendy z UI czekają najwyżej tyle,
+        // a log dostaje jeden rekord na partię zamiast na każdy dzień
+        const Clock::time_point until = now + PUBLISH_INTERVAL;
+        do
+        {
+            const unsigned short left = MAX_GAME_DAY - m_time.currentGameDay();
+            if (left == 0)
+            {
+                campaignEnded();
+                return;
+            }
+
+            const Clock::time_point chunkStart = Clock::now();
+            m_dispatcher.advanceDays(std::min(m_maxSpeedChunk, left));
+            const Clock::time_point chunkEnd = Clock::now();
+
+            // partia zajęła ponad ćwierć okna - mniejsza; dużo krótsza - większa
+            if ((chunkEnd - chunkStart) * 4 > PUBLISH_INTERVAL)
+                m_maxSpeedChunk = std::max<unsigned short>(1, m_maxSpeedChunk / 2);
+            else if ((chunkEnd - chunkStart) * 16 < PUBLISH_INTERVAL && m_maxSpeedChunk < MAX_SPEED_CHUNK)
+                m_maxSpeedChunk *= 2;
+        } while (Clock::now() < until);
+        return;
+    }
+
+    default:
+    {
+        m_dayDebt += std::chrono::duration<double>(elapsed).count() * daysPerSecond(speed);
+        const auto days = static_cast<unsigned short>(std::min<double>(m_dayDebt, remaining));
+        if (days == 0)
+            return;
+
+        m_dayDebt -= days;
+        m_dispatcher.advanceDays(days);
+        return;
+    }
+    }
+}
+
+void SimulationThread::campaignEnded()
+{
+    m_speed.store(GameSpeed::Paused, std::memory_order_release);
+    m_dayDebt = 0.0;
+}
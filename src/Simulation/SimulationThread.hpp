@@ -0,0 +1,111 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include "../Core/header/SpscQueue.hpp"
+#include "../Resources/ResourceMissing.hpp"
+#include "CommandDispatcher.hpp"
+#include "CommandQueue.hpp"
+#include "SimulationStateView.hpp"
+
+using std::function;
+
+enum class GameSpeed : std::uint8_t
+{
+    Paused,
+    OneDayPerSecond,
+    TenDaysPerSecond,
+    // Bez pauz - dzień po dniu, ile zmieści się w jednym wątku.
+    Max,
+    Count
+};
+
+static const constexpr size_t GAME_SPEED_COUNT = static_cast<size_t>(GameSpeed::Count);
+
+const char *gameSpeedName(GameSpeed speed);
+
+// Zdarzenia modelu przekazywane z wątku symulacji do UI (popup, podświetlenie braków).
+enum class SimulationEventType : std::uint8_t
+{
+    ResearchCompleted,
+    ResearchMissingResources
+};
+
+struct SimulationEvent
+{
+    SimulationEventType m_type = SimulationEventType::ResearchCompleted;
+    TechId m_techId = INVALID_TECH_ID;
+    ResourceMissing m_missing;
+};
+
+// Wątek symulacji: jedyny, który zmienia stan gry po start().
+//
+// W każdym obiegu wykonuje komendy z CommandQueue, przesuwa czas zgodnie
+// z prędkością gry i publikuje widok stanu (StateViewPublisher), jeśli coś się
+// zmieniło. UI czyta tylko widoki, a zdarzenia modelu dostaje przez pollEvent.
+// Na pauzie wątek śpi do następnej komendy lub zmiany prędkości.
+class SimulationThread
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static const constexpr size_t EVENT_CAPACITY = 64;
+    // Na prędkości Max publikacja co tyle (~60 widoków na sekundę).
+    static const constexpr Clock::duration PUBLISH_INTERVAL = std::chrono::milliseconds(16);
+    // Górna granica partii dni na prędkości Max (jedna komenda w logu na partię).
+    static const constexpr unsigned short MAX_SPEED_CHUNK = 1024;
+    // Odstęp obiegów przy prędkościach czasowych - opóźnienie komend z UI.
+    static const constexpr Clock::duration TICK_SLICE = std::chrono::milliseconds(5);
+
+    SimulationThread(TimeDataModel &time,
+                     ResearchManager &research,
+                     CommandDispatcher &dispatcher,
+                     CommandQueue &commands,
+                     StateViewPublisher &publisher);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread &) = delete;
+    SimulationThread &operator=(const SimulationThread &) = delete;
+
+    // Wołane na wątku symulacji po każdej publikacji (np. budzenie pętli okna).
+    // Ustawiać przed start().
+    void setPublishedCallback(function<void()> callback) { m_onPublished = std::move(callback); }
+
+    void start();
+    // Kończy bieżący obieg i czeka na wątek; komendy jeszcze w kolejce zostają niewykonane.
+    void stop();
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    // --- wątek UI ---
+    void setSpeed(GameSpeed speed);
+    GameSpeed speed() const { return m_speed.load(std::memory_order_acquire); }
+    bool pollEvent(SimulationEvent &event) { return m_events.tryPop(event); }
+
+private:
+    void run();
+    void advance(GameSpeed speed);
+    // Koniec kampanii (MAX_GAME_DAY) - dalej tylko pauza.
+    void campaignEnded();
+    // Pełna kolejka gubi zdarzenie - to tylko powiadomienia UI, stan jest w widoku.
+    void pushEvent(const SimulationEvent &event) { m_events.tryPush(event); }
+
+private:
+    TimeDataModel &m_time;
+    CommandDispatcher &m_dispatcher;
+    CommandQueue &m_commands;
+    StateViewPublisher &m_publisher;
+    function<void()> m_onPublished;
+
+    std::atomic<GameSpeed> m_speed{GameSpeed::Paused};
+    std::atomic<bool> m_running{false};
+    std::thread m_thread;
+    SpscQueue<SimulationEvent, EVENT_CAPACITY> m_events;
+
+    // tylko wątek symulacji
+    Clock::time_point m_lastTick;
+    double m_dayDebt = 0.0;
+    // Rozmiar partii na prędkości Max - dopasowywany tak, żeby kilka partii mieściło się w PUBLISH_INTERVAL.
+    unsigned short m_maxSpeedChunk = 1;
+};
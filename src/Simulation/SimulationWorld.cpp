@@ -0,0 +1,102 @@
+#include "SimulationWorld.hpp"
+
+using std::make_unique;
+
+namespace
+{
+    // Osobny strumień dla wyników badań - ten sam seed co m_rng dałby identyczne losowania.
+    unsigned long long researchSeed(unsigned long long seed)
+    {
+        return seed ^ 0x5245534541524348ull;
+    }
+}
+
+SimulationWorld::SimulationWorld(const ResourceConstraints &constraints,
+                                 const string &technologiesPath,
+                                 unsigned long long seed,
+                                 ResearchOutcomeMode outcomeMode)
+    : m_timeModel(),
+      m_resourceConstraints(constraints),
+      m_resourcesManager(m_resourceConstraints, m_timeModel),
+      m_researchManager(m_timeModel, m_resourcesManager),
+      m_scheduler(m_timeModel),
+      m_rng(seed)
+{
+    m_researchManager.loadFromJsonCached(technologiesPath);
+    m_researchManager.setOutcomeMode(outcomeMode, researchSeed(seed));
+    registerHorizons();
+}
+
+SimulationWorld::SimulationWorld(const ResourceConstraints &constraints,
+                                 const vector<Technology> &technologies,
+                                 unsigned long long seed,
+                                 ResearchOutcomeMode outcomeMode)
+    : m_timeModel(),
+      m_resourceConstraints(constraints),
+      m_resourcesManager(m_resourceConstraints, m_timeModel),
+      m_researchManager(m_timeModel, m_resourcesManager),
+      m_scheduler(m_timeModel),
+      m_rng(seed)
+{
+    m_researchManager.loadTechnologies(technologies);
+    m_researchManager.setOutcomeMode(outcomeMode, researchSeed(seed));
+    registerHorizons();
+}
+
+void SimulationWorld::registerHorizons()
+{
+    m_scheduler.addHorizon([this](const TimeDataModel &)
+                           { return m_resourcesManager.daysUntilNextEvent(); });
+    m_scheduler.addHorizon([this](const TimeDataModel &)
+                           { return m_researchManager.daysUntilNextCompletion(); });
+}
+
+vector<byte> SimulationWorld::saveSnapshot(vector<byte> reuse) const
+{
+    SnapshotWriter writer(std::move(reuse));
+    writer.writeHeader();
+    m_timeModel.writeSnapshot(writer);
+    m_resourcesManager.writeSnapshot(writer);
+    m_researchManager.writeSnapshot(writer);
+
+    writer.write(m_rng.state());
+
+    return writer.release();
+}
+
+bool SimulationWorld::loadSnapshot(span<const byte> bytes)
+{
+    SnapshotReader reader(bytes);
+    if (!reader.readHeader())
+        return false;
+
+    if (!m_timeModel.readSnapshot(reader) ||
+        !m_resourcesManager.readSnapshot(reader) ||
+        !m_researchManager.readSnapshot(reader))
+        return false;
+
+    Xoshiro256::State rngState{};
+    if (!reader.read(rngState) || !reader.atEnd())
+        return false;
+
+    return m_rng.setState(rngState);
+}
+
+bool SimulationWorld::saveToFile(const string &path) const
+{
+    return saveSnapshotFile(path, saveSnapshot());
+}
+
+bool SimulationWorld::loadFromFile(const string &path)
+{
+    vector<byte> bytes;
+    return loadSnapshotFile(path, bytes) && loadSnapshot(bytes);
+}
+
+unique_ptr<SimulationWorld> SimulationWorld::fork() const
+{
+    auto copy = make_unique<SimulationWorld>(m_resourceConstraints, m_researchManager.getAllTechnologies());
+    if (!copy->loadSnapshot(saveSnapshot()))
+        return nullptr;
+    return copy;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#include "../Core/header/TimeSystem.hpp"
+#include "../Core/header/EventScheduler.hpp"
+#include "../Core/header/Random.hpp"
+#include "../Core/header/Snapshot.hpp"
+#include "../Resources/ResourceConstraints.hpp"
+#include "../Resources/ResourcesManager.hpp"
+#include "../Research/ResearchManager.hpp"
+
+using std::span;
+using std::unique_ptr;
+using std::string;
+using std::vector;
+
+// Kompletny, samodzielny świat gry bez SDL/OpenGL/ImGui.
+// Składa modele dokładnie tak jak main.cpp: czas -> zasoby -> badania.
+// Świat nie jest kopiowalny ani przenoszalny (obserwatorzy trzymają `this`),
+// nie ma też żadnego współdzielonego stanu - każdy ma własny generator losowy.
+class SimulationWorld
+{
+public:
+    // Technologie z JSON przez binarny cache (ResearchManager::loadFromJsonCached).
+    // Generator wyników badań (outcomeMode) dostaje seed wyprowadzony z `seed`,
+    // więc w trybie Randomized każda kampania ma inne, ale powtarzalne wyniki.
+    SimulationWorld(const ResourceConstraints &constraints,
+                    const string &technologiesPath,
+                    unsigned long long seed = 0,
+                    ResearchOutcomeMode outcomeMode = ResearchOutcomeMode::Deterministic);
+    // Technologie kopiowane z gotowego prototypu (bez ponownego parsowania JSON).
+    SimulationWorld(const ResourceConstraints &constraints,
+                    const vector<Technology> &technologies,
+                    unsigned long long seed = 0,
+                    ResearchOutcomeMode outcomeMode = ResearchOutcomeMode::Deterministic);
+    ~SimulationWorld() = default;
+
+    SimulationWorld(const SimulationWorld &) = delete;
+    SimulationWorld &operator=(const SimulationWorld &) = delete;
+
+    TimeDataModel &time() { return m_timeModel; }
+    const TimeDataModel &time() const { return m_timeModel; }
+    EventHorizonScheduler &scheduler() { return m_scheduler; }
+    ResourcesManager &resources() { return m_resourcesManager; }
+    const ResourcesManager &resources() const { return m_resourcesManager; }
+    ResearchManager &research() { return m_researchManager; }
+    const ResearchManager &research() const { return m_researchManager; }
+    Xoshiro256 &rng() { return m_rng; }
+
+    // Binarny snapshot: czas, zasoby, badania i stan generatora losowego.
+    // a_reuse pozwala oddać bufor poprzedniego snapshotu (bez alokacji przy częstym zapisie).
+    vector<byte> saveSnapshot(vector<byte> reuse = {}) const;
+    // Przy błędzie zwraca false; świat może być wtedy częściowo nadpisany.
+    bool loadSnapshot(span<const byte> bytes);
+    bool saveToFile(const string &path) const;
+    bool loadFromFile(const string &path);
+    // Niezależna kopia świata do symulacji "co jeśli" (bez listenerów dodanych z zewnątrz).
+    // nullptr, gdy stanu nie udało się przenieść (nigdy częściowo wczytany świat).
+    unique_ptr<SimulationWorld> fork() const;
+
+private:
+    // Kolejność pól = kolejność konstrukcji (i rejestracji obserwatorów).
+    TimeDataModel m_timeModel;
+    ResourceConstraints m_resourceConstraints;
+    ResourcesManager m_resourcesManager;
+    ResearchManager m_researchManager;
+    EventHorizonScheduler m_scheduler;
+    Xoshiro256 m_rng;
+
+private:
+    void registerHorizons();
+};
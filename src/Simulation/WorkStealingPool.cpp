@@ -0,0 +1,114 @@
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+
+using std::lock_guard;
+using std::make_unique;
+using std::max;
+using std::move;
+using std::unique_lock;
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount)
+{
+    if (threadCount == 0)
+        threadCount = max(1u, thread::hardware_concurrency());
+
+    for (unsigned i = 0; i < threadCount; ++i)
+        m_queues.push_back(make_unique<WorkerQueue>());
+
+    for (unsigned i = 0; i < threadCount; ++i)
+        m_workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        lock_guard lock(m_stateMutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto &worker : m_workers)
+        worker.join();
+}
+
+void WorkStealingPool::submit(Task task)
+{
+    unsigned target;
+    {
+        lock_guard lock(m_stateMutex);
+        target = m_nextQueue;
+        m_nextQueue = (m_nextQueue + 1) % m_queues.size();
+        // pod m_stateMutex, żeby śpiący wątek nie przegapił powiadomienia
+        m_pendingTasks++;
+        m_queuedTasks++;
+    }
+
+    {
+        lock_guard lock(m_queues[target]->m_mutex);
+        m_queues[target]->m_tasks.push_back(move(task));
+    }
+
+    m_workAvailable.notify_one();
+}
+
+void WorkStealingPool::wait()
+{
+    unique_lock lock(m_stateMutex);
+    m_allDone.wait(lock, [this] { return m_pendingTasks == 0; });
+}
+
+bool WorkStealingPool::popLocal(unsigned index, Task &task)
+{
+    auto &queue = *m_queues[index];
+    lock_guard lock(queue.m_mutex);
+    if (queue.m_tasks.empty())
+        return false;
+
+    task = move(queue.m_tasks.front());
+    queue.m_tasks.pop_front();
+    m_queuedTasks--;
+    return true;
+}
+
+bool WorkStealingPool::steal(unsigned thiefIndex, Task &task)
+{
+    const unsigned count = static_cast<unsigned>(m_queues.size());
+    for (unsigned offset = 1; offset < count; ++offset)
+    {
+        auto &victim = *m_queues[(thiefIndex + offset) % count];
+        lock_guard lock(victim.m_mutex);
+        if (victim.m_tasks.empty())
+            continue;
+
+        task = move(victim.m_tasks.back());
+        victim.m_tasks.pop_back();
+        m_queuedTasks--;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(unsigned index)
+{
+    while (true)
+    {
+        Task task;
+        if (popLocal(index, task) || steal(index, task))
+        {
+            task();
+
+            if (--m_pendingTasks == 0)
+            {
+                // lock, żeby wait() nie przegapił powiadomienia
+                lock_guard lock(m_stateMutex);
+                m_allDone.notify_all();
+            }
+            continue;
+        }
+
+        unique_lock lock(m_stateMutex);
+        m_workAvailable.wait(lock, [this] { return m_stopping || m_queuedTasks > 0; });
+        if (m_stopping && m_queuedTasks == 0)
+            return;
+    }
+}
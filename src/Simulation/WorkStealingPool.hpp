@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using std::atomic;
+using std::condition_variable;
+using std::deque;
+using std::function;
+using std::mutex;
+using std::thread;
+using std::unique_ptr;
+using std::vector;
+
+// Pula wątków z kradzieżą zadań.
+// Każdy wątek ma własną kolejkę: bierze zadania z przodu swojej kolejki,
+// a gdy ta jest pusta, kradnie z tyłu kolejek innych wątków.
+class WorkStealingPool
+{
+public:
+    using Task = function<void()>;
+
+    // threadCount == 0 -> std::thread::hardware_concurrency()
+    explicit WorkStealingPool(unsigned threadCount = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    void submit(Task task);
+    // Blokuje do zakończenia wszystkich zgłoszonych zadań.
+    void wait();
+
+    unsigned threadCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+private:
+    struct WorkerQueue
+    {
+        mutex m_mutex;
+        deque<Task> m_tasks;
+    };
+
+    void workerLoop(unsigned index);
+    bool popLocal(unsigned index, Task &task);
+    bool steal(unsigned thiefIndex, Task &task);
+
+private:
+    vector<unique_ptr<WorkerQueue>> m_queues;
+    vector<thread> m_workers;
+
+    mutex m_stateMutex;
+    condition_variable m_workAvailable;
+    condition_variable m_allDone;
+    // Zadania zgłoszone, ale jeszcze nie zakończone.
+    atomic<unsigned long> m_pendingTasks{0};
+    // Zadania leżące w kolejkach (jeszcze nie pobrane przez żaden wątek).
+    atomic<unsigned long> m_queuedTasks{0};
+    unsigned m_nextQueue = 0;
+    bool m_stopping = false;
+};
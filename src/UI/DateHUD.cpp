@@ -1,9 +1,9 @@
 #include "DateHUD.hpp"
 #include "imgui.h"
 
-void DateHUD::Draw(TimeDataModel &time)
+void DateHUD::Draw(const SimulationStateView &view, GameSpeed speed)
 {
-    const auto &date = time.currentDate();
+    const auto &date = view.m_date;
 
     auto &io = ImGui::GetIO();
 
@@ -30,19 +30,45 @@ void DateHUD::Draw(TimeDataModel &time)
                 date.day(), date.month(), date.year());
 
     ImGui::Text("Day Of Week: %d",
-                (int)time.currentDayOfWeek() + 1);
+                (int)view.m_dayOfWeek + 1);
 
-    ImGui::Text("Game day: %d", time.currentGameDay());
+    ImGui::Text("Game day: %d", view.m_gameDay);
+
+    // prędkość gry - czas płynie na wątku symulacji
+    for (size_t i = 0; i < GAME_SPEED_COUNT; ++i)
+    {
+        const GameSpeed option = static_cast<GameSpeed>(i);
+        if (i > 0)
+            ImGui::SameLine();
+        if (ImGui::RadioButton(gameSpeedName(option), speed == option) && speed != option)
+            m_requestedSpeed = option;
+    }
 
     if (ImGui::Button("Next day"))
     {
-        time.nextDay();
+        m_requestedDays = 1;
     }
 
+    ImGui::SameLine();
+
     if (ImGui::Button("Next 10 days"))
     {
-        time.nextTeenDays();
+        m_requestedDays = 10;
     }
 
     ImGui::End();
 }
+
+unsigned short DateHUD::TakeRequestedDays()
+{
+    const unsigned short days = m_requestedDays;
+    m_requestedDays = 0;
+    return days;
+}
+
+std::optional<GameSpeed> DateHUD::TakeRequestedSpeed()
+{
+    const std::optional<GameSpeed> speed = m_requestedSpeed;
+    m_requestedSpeed.reset();
+    return speed;
+}
@@ -1,18 +1,25 @@
 #pragma once
-#include "../Core/header/TimeSystem.hpp"
+#include <optional>
+#include "../Simulation/SimulationStateView.hpp"
+#include "../Simulation/SimulationThread.hpp"
 #include "IHUD.hpp"
 #include "imgui.h"
 
 class DateHUD : public IHUD
 {
 public:
-    void Draw(TimeDataModel &time);
+    void Draw(const SimulationStateView &view, GameSpeed speed);
+    // Dni zamówione przyciskami w tej klatce (0 = brak). main.cpp przekazuje je
+    // do kolejki komend wątku symulacji.
+    unsigned short TakeRequestedDays();
+    // Prędkość gry wybrana w tej klatce.
+    std::optional<GameSpeed> TakeRequestedSpeed();
     bool IsVisible() const override { return m_visible; }
     void SetVisible(bool v) override { m_visible = v; }
 
 private:
     ImVec2 m_position;
-    ImVec2 m_windowSize = ImVec2(200.f, 100.f);
+    ImVec2 m_windowSize = ImVec2(280.f, 125.f);
     ImGuiWindowFlags m_flags =
         ImGuiWindowFlags_NoTitleBar |
         ImGuiWindowFlags_NoMove |
@@ -20,4 +27,6 @@ private:
         ImGuiWindowFlags_NoScrollbar |
         ImGuiWindowFlags_NoBackground; // fajnie wygląda jak overlay
     bool m_visible = true;
+    unsigned short m_requestedDays = 0;
+    std::optional<GameSpeed> m_requestedSpeed;
 };
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "ProfilerHUD.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <format>
+
+// =====================================================
+// MAIN DRAW
+// =====================================================
+void ProfilerHUD::Draw(FrameProfiler &profiler)
+{
+    if (!m_visible)
+        return;
+
+    ImGui::SetNextWindowSize(ImVec2(420.f, 480.f), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Profiler", &m_visible, m_flags);
+
+    if (!m_visible)
+    {
+        ImGui::End();
+        return;
+    }
+
+    DrawFrameTimes(profiler);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    DrawSections(profiler);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    DrawCapture(profiler);
+
+    ImGui::End();
+}
+
+// =====================================================
+// FRAME TIME
+// =====================================================
+void ProfilerHUD::DrawFrameTimes(const FrameProfiler &profiler)
+{
+    const float average = profiler.averageFrameMs();
+
+    ImGui::Text("Frame: %.2f ms avg (%.0f FPS), %.2f ms max",
+                average, average > 0.f ? 1000.f / average : 0.f, profiler.maxFrameMs());
+
+    ImGui::PlotHistogram(
+        "##frames",
+        profiler.frameHistory().data(),
+        static_cast<int>(PROFILER_HISTORY_FRAMES),
+        static_cast<int>(profiler.historyOffset()),
+        nullptr,
+        0.f,
+        33.3f,
+        ImVec2(-1.f, 80.f));
+}
+
+// =====================================================
+// PER-SECTION TIMES
+// =====================================================
+void ProfilerHUD::DrawSections(const FrameProfiler &profiler)
+{
+    ImGui::Text("Sections (ms per frame)");
+
+    for (const auto &section : profiler.sections())
+    {
+        float sum = 0.f;
+        float peak = 0.f;
+        for (float ms : section.m_history)
+        {
+            sum += ms;
+            peak = std::max(peak, ms);
+        }
+        const float average = sum / static_cast<float>(PROFILER_HISTORY_FRAMES);
+
+        ImGui::PlotLines(
+            std::format("##{}", section.m_name).c_str(),
+            section.m_history.data(),
+            static_cast<int>(PROFILER_HISTORY_FRAMES),
+            static_cast<int>(profiler.historyOffset()),
+            std::format("{}: {:.3f} avg / {:.3f} max", section.m_name, average, peak).c_str(),
+            0.f,
+            std::max(peak, 1.f),
+            ImVec2(-1.f, 40.f));
+    }
+}
+
+// =====================================================
+// CHROME TRACE CAPTURE
+// =====================================================
+void ProfilerHUD::DrawCapture(FrameProfiler &profiler)
+{
+    ImGui::Text("Chrome trace");
+
+    ImGui::InputInt("Frames", &m_captureFrames);
+    if (m_captureFrames < 1)
+        m_captureFrames = 1;
+
+    if (profiler.isCapturing())
+    {
+        ImGui::BeginDisabled();
+        ImGui::Button("Capturing...");
+        ImGui::EndDisabled();
+    }
+    else if (ImGui::Button("Capture"))
+    {
+        profiler.startCapture(static_cast<unsigned>(m_captureFrames));
+        m_lastExportStatus.clear();
+    }
+
+    ImGui::SameLine();
+
+    const bool canExport = !profiler.isCapturing() && !profiler.capturedEvents().empty();
+    if (!canExport)
+        ImGui::BeginDisabled();
+
+    if (ImGui::Button("Export"))
+    {
+        m_lastExportStatus = profiler.writeChromeTrace(m_tracePath)
+                                 ? std::format("Saved {} events to {}", profiler.capturedEvents().size(), m_tracePath)
+                                 : std::format("Failed to write {}", m_tracePath);
+    }
+
+    if (!canExport)
+        ImGui::EndDisabled();
+
+    if (!m_lastExportStatus.empty())
+        ImGui::TextWrapped("%s", m_lastExportStatus.c_str());
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+#include "imgui.h"
+#include "../Core/header/Profiler.hpp"
+#include "IHUD.hpp"
+
+class ProfilerHUD : public IHUD
+{
+public:
+    void Draw(FrameProfiler &profiler);
+    bool IsVisible() const override { return m_visible; }
+    void SetVisible(bool v) override { m_visible = v; }
+
+private:
+    void DrawFrameTimes(const FrameProfiler &profiler);
+    void DrawSections(const FrameProfiler &profiler);
+    void DrawCapture(FrameProfiler &profiler);
+
+private:
+    bool m_visible = false;
+    int m_captureFrames = 300;
+    std::string m_tracePath = "manhattan_trace.json";
+    std::string m_lastExportStatus;
+
+    ImGuiWindowFlags m_flags =
+        ImGuiWindowFlags_NoCollapse;
+};
@@ -1,5 +1,7 @@
 #include "ResearchHUD.hpp"
 #include "imgui.h"
+#include <algorithm>
+#include <cstdio>
 #include <format>
 
 #include "ResearchHUD.hpp"
@@ -25,26 +27,37 @@ void ResearchHUD::Draw(ResearchManager &manager)
     // ============================================================
     // 1. ACTIVE RESEARCH (TOP PANEL)
     // ============================================================
-    if (const Technology *active = manager.getActiveResearch())
+    if (!manager.getActiveResearches().empty())
     {
-        float progress =
-            static_cast<float>(active->m_progressDays) /
-            static_cast<float>(active->m_researchDays);
-
         ImGui::Text("Currently researching:");
-        ImGui::SameLine();
-        ImGui::TextColored(ImVec4(1.f, 0.85f, 0.4f, 1.f),
-                           "%s", active->m_name.c_str());
 
-        ImGui::PushStyleColor(ImGuiCol_PlotHistogram,
-                              ImVec4(0.2f, 0.8f, 0.3f, 1.0f));
+        for (const auto &slot : manager.getActiveResearches())
+        {
+            const Technology &active = manager.getTechnology(slot.m_techId);
+            float progress =
+                static_cast<float>(slot.m_progressDays) /
+                static_cast<float>(std::max(slot.m_researchDays, 1u));
 
-        ImGui::ProgressBar(
-            progress,
-            ImVec2(-1.f, 0.f),
-            std::format("{:.0f}%%", progress * 100.f).c_str());
+            ImGui::TextColored(ImVec4(1.f, 0.85f, 0.4f, 1.f),
+                               "%s", active.m_name.c_str());
 
-        ImGui::PopStyleColor();
+            ImGui::PushStyleColor(ImGuiCol_PlotHistogram,
+                                  ImVec4(0.2f, 0.8f, 0.3f, 1.0f));
+
+            ImGui::ProgressBar(
+                progress,
+                ImVec2(-1.f, 0.f),
+                std::format("{:.0f}%%", progress * 100.f).c_str());
+
+            ImGui::PopStyleColor();
+        }
+
+        // oczekujące w kolejce (startują same po zwolnieniu personelu)
+        for (const auto &queued : manager.getResearchQueue())
+        {
+            ImGui::TextDisabled("Queued: %s",
+                                manager.getTechnology(queued.m_techId).m_name.c_str());
+        }
 
         ImGui::Spacing();
         ImGui::Separator();
@@ -59,113 +72,160 @@ void ResearchHUD::Draw(ResearchManager &manager)
     }
 
     // ============================================================
-    // 2. TECHNOLOGY LIST
+    // 2. TECHNOLOGY LIST (zakładki + tylko widoczne wiersze)
     // ============================================================
-    for (const auto &[id, tech] : manager.getAllTechnologies())
+    // wersja stanu podbijana przez subskrypcję - zakładki przebudowywane tylko po zmianie
+    if (!m_stateSubscription.isActive())
     {
-        bool isCompleted = tech.isCompleted();
-        bool isInProgress = tech.isInProgress();
-        bool isAvailable = manager.isAvailable(id);
-
-        bool isLocked = !isAvailable && !isCompleted && !isInProgress;
-
-        // --------------------------------------------------------
-        // COLOR SELECTION
-        // --------------------------------------------------------
-        if (isCompleted)
-            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.3f, 1.f, 0.3f, 1.f)); // green
-        else if (isInProgress)
-            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.f, 0.85f, 0.4f, 1.f)); // yellow
-        else if (isLocked)
-            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.f)); // gray
-        else
-            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.f, 1.f, 1.f, 1.f)); // white
+        m_researchVersion++;
+        m_stateSubscription = manager.subscribeStateChanged([this](TechId)
+                                                            { m_researchVersion++; });
+    }
 
-        // --------------------------------------------------------
-        // BUTTON
-        // --------------------------------------------------------
-        bool disableButton = isLocked || isCompleted;
+    const auto &techs = manager.getAllTechnologies();
+    m_model.Update(techs, m_researchVersion,
+                   [&](TechId techId) { return techs[techId].m_state; });
 
-        if (disableButton)
-            ImGui::BeginDisabled();
+    if (ImGui::BeginTabBar("ResearchFilters"))
+    {
+        char label[64];
+        for (size_t i = 0; i < RESEARCH_FILTER_COUNT; ++i)
+        {
+            const auto filter = static_cast<ResearchFilter>(i);
+            std::snprintf(label, sizeof(label), "%s (%zu)###%s",
+                          ResearchFilterName(filter), m_model.Items(filter).size(), ResearchFilterName(filter));
 
-        bool clicked = ImGui::Button(
-            tech.m_name.c_str(),
-            ImVec2(-1.f, 0.f));
+            if (ImGui::BeginTabItem(label))
+            {
+                if (ImGui::BeginChild("##items"))
+                {
+                    const auto &items = m_model.Items(filter);
+                    const float statusWidth = ImGui::GetContentRegionAvail().x * 0.3f;
+
+                    ImGuiListClipper clipper;
+                    clipper.Begin(static_cast<int>(items.size()), ImGui::GetFrameHeightWithSpacing());
+                    while (clipper.Step())
+                    {
+                        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                            DrawTechRow(manager, techs[items[row]], statusWidth);
+                    }
+                }
+                ImGui::EndChild();
+                ImGui::EndTabItem();
+            }
+        }
+        ImGui::EndTabBar();
+    }
 
-        if (disableButton)
-            ImGui::EndDisabled();
+    ImGui::End();
+}
 
-        ImGui::PopStyleColor();
+void ResearchHUD::DrawTechRow(ResearchManager &manager, const Technology &tech, float statusWidth)
+{
+    bool isCompleted = tech.isCompleted();
+    bool isInProgress = tech.isInProgress();
+    bool isAvailable = tech.isAvailable();
+
+    bool isLocked = !isAvailable && !isCompleted && !isInProgress;
+
+    ImGui::PushID(static_cast<int>(tech.m_index));
+
+    // --------------------------------------------------------
+    // COLOR SELECTION
+    // --------------------------------------------------------
+    if (isCompleted)
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.3f, 1.f, 0.3f, 1.f)); // green
+    else if (isInProgress)
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.f, 0.85f, 0.4f, 1.f)); // yellow
+    else if (isLocked)
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.f)); // gray
+    else
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.f, 1.f, 1.f, 1.f)); // white
 
-        // --------------------------------------------------------
-        // TOOLTIP (AFTER BUTTON!)
-        // --------------------------------------------------------
-        if (ImGui::IsItemHovered())
-        {
-            ImGui::BeginTooltip();
-            ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35.f);
+    // --------------------------------------------------------
+    // BUTTON
+    // --------------------------------------------------------
+    bool disableButton = isLocked || isCompleted;
 
-            ImGui::TextColored(ImVec4(0.9f, 0.9f, 0.4f, 1.f),
-                               "%s", tech.m_name.c_str());
-            ImGui::Separator();
+    if (disableButton)
+        ImGui::BeginDisabled();
 
-            ImGui::TextWrapped("%s", tech.m_description.c_str());
+    bool clicked = ImGui::Button(
+        tech.m_name.c_str(),
+        ImVec2(-statusWidth, 0.f));
 
-            ImGui::Spacing();
-            ImGui::Text("Cost: %u $", tech.m_moneyCost);
-            ImGui::Text("Duration: %u days", tech.m_researchDays);
+    if (disableButton)
+        ImGui::EndDisabled();
 
-            if (!tech.m_prerequisites.empty())
-            {
-                ImGui::Separator();
-                ImGui::Text("Requires:");
-                for (const auto &pre : tech.m_prerequisites)
-                    ImGui::BulletText("%s", pre.c_str());
-            }
+    ImGui::PopStyleColor();
 
-            ImGui::PopTextWrapPos();
-            ImGui::EndTooltip();
-        }
+    // --------------------------------------------------------
+    // TOOLTIP (AFTER BUTTON!)
+    // --------------------------------------------------------
+    if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+    {
+        ImGui::BeginTooltip();
+        ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35.f);
 
-        // --------------------------------------------------------
-        // CLICK HANDLING
-        // --------------------------------------------------------
-        if (clicked && !disableButton)
-        {
-            manager.startResearch(id);
-        }
+        ImGui::TextColored(ImVec4(0.9f, 0.9f, 0.4f, 1.f),
+                           "%s", tech.m_name.c_str());
+        ImGui::Separator();
+
+        ImGui::TextWrapped("%s", tech.m_description.c_str());
 
-        // --------------------------------------------------------
-        // COMPLETED TAG
-        // --------------------------------------------------------
-        if (isCompleted)
+        ImGui::Spacing();
+        ImGui::Text("Cost: %u $", tech.m_moneyCost);
+        ImGui::Text("Duration: %u days", tech.m_researchDays);
+
+        if (!tech.m_prerequisites.empty())
         {
-            ImGui::SameLine();
-            ImGui::TextDisabled("(Done)");
+            ImGui::Separator();
+            ImGui::Text("Requires:");
+            for (const auto &pre : tech.m_prerequisites)
+                ImGui::BulletText("%s", pre.str().c_str());
         }
 
-        // --------------------------------------------------------
-        // PER-TECH PROGRESS BAR
-        // --------------------------------------------------------
-        if (isInProgress)
-        {
-            float p =
-                static_cast<float>(tech.m_progressDays) /
-                static_cast<float>(tech.m_researchDays);
+        ImGui::PopTextWrapPos();
+        ImGui::EndTooltip();
+    }
 
-            ImGui::PushStyleColor(ImGuiCol_PlotHistogram,
-                                  ImVec4(1.f, 0.6f, 0.2f, 1.f));
+    // --------------------------------------------------------
+    // CLICK HANDLING
+    // --------------------------------------------------------
+    if (clicked && !disableButton)
+    {
+        // Shift+klik dodaje do kolejki zamiast startować od razu
+        if (ImGui::GetIO().KeyShift)
+            manager.queueResearch(tech.m_index);
+        else
+            manager.startResearch(tech.m_index);
+    }
 
-            ImGui::ProgressBar(p, ImVec2(-1.f, 0.f));
+    // --------------------------------------------------------
+    // STATUS (ta sama linia - stała wysokość wiersza)
+    // --------------------------------------------------------
+    ImGui::SameLine();
+    if (isInProgress)
+    {
+        float p = manager.getProgress(tech.m_index);
 
-            ImGui::PopStyleColor();
-        }
+        ImGui::PushStyleColor(ImGuiCol_PlotHistogram,
+                              ImVec4(1.f, 0.6f, 0.2f, 1.f));
 
-        ImGui::Spacing();
+        ImGui::ProgressBar(p, ImVec2(-1.f, 0.f));
+
+        ImGui::PopStyleColor();
+    }
+    else if (isCompleted)
+    {
+        ImGui::TextDisabled("(Done)");
+    }
+    else
+    {
+        ImGui::Dummy(ImVec2(0.f, 0.f));
     }
 
-    ImGui::End();
+    ImGui::PopID();
 }
 
 void ResearchHUD::DrawTechTree(ResearchManager &manager)
@@ -185,7 +245,7 @@ void ResearchHUD::DrawTechTree(ResearchManager &manager)
 
     const auto &techs = manager.getAllTechnologies();
 
-    for (const auto &[id, tech] : techs)
+    for (const auto &tech : techs)
     {
         // Root = technologie bez prerequisite
         bool isRoot = tech.m_prerequisites.empty();
@@ -274,7 +334,7 @@ void ResearchHUD::DrawTechNode(ResearchManager &manager, const Technology &tech)
             ImGui::Text("Requires:");
             for (auto &pre : tech.m_prerequisites)
             {
-                ImGui::BulletText("%s", pre.c_str());
+                ImGui::BulletText("%s", pre.str().c_str());
             }
         }
 
@@ -283,25 +343,18 @@ void ResearchHUD::DrawTechNode(ResearchManager &manager, const Technology &tech)
     }
 
     // Po kliknięciu na węzeł → rozpocznij badanie
-    if (ImGui::IsItemClicked() && manager.isAvailable(tech.m_id))
+    if (ImGui::IsItemClicked() && tech.isAvailable())
     {
-        manager.startResearch(tech.m_id);
+        manager.startResearch(tech.m_index);
     }
 
     if (!open)
         return;
 
-    // Rekurencyjnie szukamy technologii które mają ten node jako prerequisite
-    for (auto &[id, t] : manager.getAllTechnologies())
+    // Rekurencyjnie rysujemy technologie, które mają ten node jako prerequisite
+    for (TechId child : manager.getDependents(tech.m_index))
     {
-        for (auto &pre : t.m_prerequisites)
-        {
-            if (pre == tech.m_id)
-            {
-                DrawTechNode(manager, t); // <--- rekurencja
-                break;
-            }
-        }
+        DrawTechNode(manager, manager.getTechnology(child)); // <--- rekurencja
     }
 
     ImGui::TreePop();
@@ -2,6 +2,7 @@
 #include "imgui.h"
 #include "../../Research/ResearchManager.hpp"
 #include "../IHUD.hpp"
+#include "ResearchListModel.hpp"
 #include <string>
 
 using std::string;
@@ -20,6 +21,8 @@ public:
 
 private:
     void DrawTechNode(ResearchManager &manager, const Technology &tech);
+    // Jeden wiersz listy o stałej wysokości (wymóg ImGuiListClipper).
+    void DrawTechRow(ResearchManager &manager, const Technology &tech, float statusWidth);
     void DrawResearchCompletedPopup();
 
 private:
@@ -28,6 +31,10 @@ private:
     bool m_visibleTechTree = true;
     string m_completedTechName;
 
+    ResearchListModel m_model;
+    ObserverSubscription m_stateSubscription;
+    std::uint64_t m_researchVersion = 0;
+
     ImGuiWindowFlags m_flags =
         ImGuiWindowFlags_NoCollapse;
 };
@@ -2,19 +2,31 @@
 
 ResearchHUDController::ResearchHUDController(
     ResearchManager& manager,
+    CommandQueue& commands,
     ResearchCompletedPopupHUD& popupHUD)
     : m_manager(manager)
+    , m_commands(commands)
     , m_popupHUD(popupHUD)
 {
-    // 🔴 Controller słucha Modelu
-    m_manager.addResearchCompletedListener(
-        [this](const Technology& tech)
-        {
-            m_popupHUD.Show(tech.m_name);
-        });
 }
 
-void ResearchHUDController::StartResearch(const std::string& techId)
+void ResearchHUDController::StartResearch(TechId techId)
 {
-    m_manager.startResearch(techId);
+    m_commands.startResearch(techId);
+}
+
+void ResearchHUDController::QueueResearch(TechId techId, int priority)
+{
+    m_commands.queueResearch(techId, priority);
+}
+
+void ResearchHUDController::DequeueResearch(TechId techId)
+{
+    m_commands.dequeueResearch(techId);
+}
+
+void ResearchHUDController::OnResearchCompleted(TechId techId)
+{
+    // nazwa to dane statyczne - bezpieczne do czytania z wątku UI
+    m_popupHUD.Show(m_manager.getTechnology(techId).m_name);
 }
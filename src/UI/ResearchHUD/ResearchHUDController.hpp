@@ -1,5 +1,6 @@
 #pragma once
 #include "../../Research/ResearchManager.hpp"
+#include "../../Simulation/CommandQueue.hpp"
 #include "ResearchCompletedPopupHUD.hpp"
 
 class ResearchHUDController
@@ -7,15 +8,24 @@ class ResearchHUDController
 public:
     ResearchHUDController(
         ResearchManager& manager,
+        CommandQueue& commands,
         ResearchCompletedPopupHUD& popupHUD);
 
     // akcje użytkownika
-    void StartResearch(const std::string& techId);
+    void StartResearch(TechId techId);
+    // kolejka - start, gdy zwolni się personel (kolejność wg priorytetu, potem FIFO)
+    void QueueResearch(TechId techId, int priority = 0);
+    void DequeueResearch(TechId techId);
+
+    // zdarzenie z wątku symulacji (SimulationThread::pollEvent)
+    void OnResearchCompleted(TechId techId);
 
     // dostęp do modelu (read-only)
     const ResearchManager& Model() const { return m_manager; }
 
 private:
     ResearchManager& m_manager;
+    // zmiany stanu idą przez kolejkę komend do wątku symulacji (log powtórek)
+    CommandQueue& m_commands;
     ResearchCompletedPopupHUD& m_popupHUD;
 };
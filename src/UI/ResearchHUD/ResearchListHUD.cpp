@@ -1,6 +1,19 @@
 #include "ResearchListHUD.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 
-void ResearchListHUD::Draw()
+namespace
+{
+    bool IsQueued(const SimulationStateView& view, TechId techId)
+    {
+        // kolejka ma kilka pozycji - wystarczy przeszukanie liniowe
+        return std::any_of(view.m_researchQueue.begin(), view.m_researchQueue.end(),
+                           [techId](const QueuedResearch& queued) { return queued.m_techId == techId; });
+    }
+}
+
+void ResearchListHUD::Draw(const SimulationStateView& view)
 {
     if (!m_visible)
         return;
@@ -11,40 +24,134 @@ void ResearchListHUD::Draw()
         return;
     }
 
-    const auto& manager = m_controller.Model();
-
-    ImGui::Text("Available Technologies");
-    ImGui::Separator();
+    const auto& techs = m_controller.Model().getAllTechnologies();
 
-    for (const auto& [id, tech] : manager.getAllTechnologies())
+    // widok opublikowany przed wczytaniem technologii - nic do pokazania
+    if (view.m_techs.size() != techs.size())
     {
-        bool locked = !manager.isAvailable(id) && !tech.isInProgress() && !tech.isCompleted();
+        ImGui::End();
+        return;
+    }
+
+    // zakładki przebudowywane tylko po zmianie stanu badań
+    m_model.Update(techs, view.m_researchVersion,
+                   [&](TechId techId) { return view.m_techs[techId].m_state; });
 
-        if (locked)
-            ImGui::BeginDisabled();
+    DrawQueue(view);
 
-        if (ImGui::Button(tech.m_name.c_str(), ImVec2(-1, 0)))
+    if (ImGui::BeginTabBar("ResearchFilters"))
+    {
+        char label[64];
+        for (size_t i = 0; i < RESEARCH_FILTER_COUNT; ++i)
         {
-            m_controller.StartResearch(id);
+            const auto filter = static_cast<ResearchFilter>(i);
+            // ### - stałe id zakładki mimo zmieniającej się liczby
+            std::snprintf(label, sizeof(label), "%s (%zu)###%s",
+                          ResearchFilterName(filter), m_model.Items(filter).size(), ResearchFilterName(filter));
+
+            if (ImGui::BeginTabItem(label))
+            {
+                DrawItems(view, m_model.Items(filter));
+                ImGui::EndTabItem();
+            }
         }
+        ImGui::EndTabBar();
+    }
 
-        if (locked)
-            ImGui::EndDisabled();
+    ImGui::End();
+}
 
-        if (tech.isInProgress())
-        {
-            float p = manager.getProgress(id);
-            ImGui::ProgressBar(p, ImVec2(-1, 0));
-        }
+void ResearchListHUD::DrawQueue(const SimulationStateView& view)
+{
+    if (view.m_researchQueue.empty())
+        return;
+
+    const auto& techs = m_controller.Model().getAllTechnologies();
 
-        if (tech.isCompleted())
+    ImGui::TextDisabled("Queued (%zu):", view.m_researchQueue.size());
+    for (const auto& queued : view.m_researchQueue)
+    {
+        ImGui::PushID(static_cast<int>(queued.m_techId));
+        if (ImGui::SmallButton("x"))
+            m_controller.DequeueResearch(queued.m_techId);
+        ImGui::SameLine();
+        ImGui::TextUnformatted(techs[queued.m_techId].m_name.c_str());
+        ImGui::PopID();
+    }
+    ImGui::Separator();
+}
+
+void ResearchListHUD::DrawItems(const SimulationStateView& view, const vector<TechId>& items)
+{
+    if (!ImGui::BeginChild("##items"))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    const auto& techs = m_controller.Model().getAllTechnologies();
+    const float statusWidth = ImGui::GetContentRegionAvail().x * 0.3f;
+
+    // wiersze o stałej wysokości - clipper rysuje tylko widoczne
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(items.size()), ImGui::GetFrameHeightWithSpacing());
+    while (clipper.Step())
+    {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
         {
-            ImGui::SameLine();
-            ImGui::Text("(Done)");
+            const TechId techId = items[row];
+            DrawRow(view, techs[techId], view.m_techs[techId], statusWidth);
         }
+    }
+
+    ImGui::EndChild();
+}
 
-        ImGui::Spacing();
+void ResearchListHUD::DrawRow(const SimulationStateView& view, const Technology& tech,
+                              const TechStateView& state, float statusWidth)
+{
+    ImGui::PushID(static_cast<int>(tech.m_index));
+
+    const bool locked = state.isLocked();
+
+    if (locked)
+        ImGui::BeginDisabled();
+
+    if (ImGui::Button(tech.m_name.c_str(), ImVec2(-statusWidth, 0)))
+    {
+        if (ImGui::GetIO().KeyShift)
+            m_controller.QueueResearch(tech.m_index);
+        else
+            m_controller.StartResearch(tech.m_index);
     }
 
-    ImGui::End();
+    if (locked)
+        ImGui::EndDisabled();
+
+    // ETA liczone po stronie symulacji, pokazywane tylko dla najechanej pozycji
+    if (!state.isCompleted() && tech.m_index < view.m_estimates.size() &&
+        ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+    {
+        const ResearchEstimate& eta = view.m_estimates[tech.m_index];
+        if (!eta.m_reachable)
+            ImGui::SetTooltip("Unreachable (missing prerequisite)");
+        else if (view.m_outcomeMode == ResearchOutcomeMode::Randomized)
+            ImGui::SetTooltip("Expected in %.0f days (+/- %.0f), failure chance %.0f%%",
+                              eta.m_expectedDays, std::sqrt(eta.m_variance),
+                              tech.m_failureProbability * 100.f);
+        else
+            ImGui::SetTooltip("Expected in %.0f days", eta.m_expectedDays);
+    }
+
+    ImGui::SameLine();
+    if (state.isInProgress())
+        ImGui::ProgressBar(state.progress(), ImVec2(-1, 0));
+    else if (state.isCompleted())
+        ImGui::TextDisabled("(Done)");
+    else if (IsQueued(view, tech.m_index))
+        ImGui::TextDisabled("(Queued)");
+    else
+        ImGui::Dummy(ImVec2(0, 0));
+
+    ImGui::PopID();
 }
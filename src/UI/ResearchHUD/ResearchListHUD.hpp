@@ -2,6 +2,8 @@
 #include "../IHUD.hpp"
 #include "imgui.h"
 #include "ResearchHUDController.hpp"
+#include "ResearchListModel.hpp"
+#include "../../Simulation/SimulationStateView.hpp"
 
 class ResearchListHUD : public IHUD
 {
@@ -9,13 +11,23 @@ public:
     explicit ResearchListHUD(ResearchHUDController& controller)
         : m_controller(controller) {}
 
-    void Draw();
+    void Draw(const SimulationStateView& view);
 
     bool IsVisible() const override { return m_visible; }
     void SetVisible(bool v) override { m_visible = v; }
 
+private:
+    // Oczekujące w kolejce, z przyciskiem usunięcia.
+    void DrawQueue(const SimulationStateView& view);
+    void DrawItems(const SimulationStateView& view, const vector<TechId>& items);
+    // Jeden wiersz stałej wysokości: przycisk + postęp / "(Queued)" / "(Done)".
+    // Klik startuje badanie, Shift+klik dodaje je do kolejki.
+    void DrawRow(const SimulationStateView& view, const Technology& tech,
+                 const TechStateView& state, float statusWidth);
+
 private:
     ResearchHUDController& m_controller;
+    ResearchListModel m_model;
     bool m_visible = true;
 
     ImGuiWindowFlags m_flags =
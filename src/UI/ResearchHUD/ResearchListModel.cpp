@@ -0,0 +1,47 @@
+#include "ResearchListModel.hpp"
+#include <algorithm>
+
+const char *ResearchFilterName(ResearchFilter filter)
+{
+    switch (filter)
+    {
+    case ResearchFilter::Available:
+        return "Available";
+    case ResearchFilter::InProgress:
+        return "In progress";
+    case ResearchFilter::Locked:
+        return "Locked";
+    case ResearchFilter::Done:
+        return "Done";
+    default:
+        return "";
+    }
+}
+
+ResearchFilter ResearchListModel::FilterOf(ResearchState state)
+{
+    switch (state)
+    {
+    case ResearchState::Available:
+        return ResearchFilter::Available;
+    case ResearchState::InProgress:
+        return ResearchFilter::InProgress;
+    case ResearchState::Completed:
+        return ResearchFilter::Done;
+    default:
+        return ResearchFilter::Locked;
+    }
+}
+
+void ResearchListModel::SortByName(const vector<Technology> &techs)
+{
+    m_sorted.resize(techs.size());
+    for (TechId i = 0; i < techs.size(); ++i)
+        m_sorted[i] = i;
+
+    std::stable_sort(m_sorted.begin(), m_sorted.end(), [&](TechId a, TechId b)
+                     { return techs[a].m_name < techs[b].m_name; });
+
+    m_techCount = techs.size();
+    m_techData = techs.data();
+}
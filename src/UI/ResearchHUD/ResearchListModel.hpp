@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "../../Research/ResearchManager.hpp"
+
+// Zakładki listy badań.
+enum class ResearchFilter : unsigned char
+{
+    Available,
+    InProgress,
+    Locked,
+    Done,
+    Count
+};
+
+static const constexpr size_t RESEARCH_FILTER_COUNT = static_cast<size_t>(ResearchFilter::Count);
+
+const char *ResearchFilterName(ResearchFilter filter);
+
+// Indeksy technologii posortowane po nazwie i rozdzielone na zakładki - dane dla
+// wirtualizowanej listy (ImGuiListClipper rysuje tylko widoczne wiersze).
+// Sortowanie liczone jest raz na wczytanie technologii, podział na zakładki tylko
+// przy zmianie wersji stanu badań, więc koszt klatki nie zależy od liczby technologii.
+class ResearchListModel
+{
+public:
+    // stateOf(TechId) -> ResearchState; wywoływane tylko przy przebudowie.
+    template <typename StateOf>
+    void Update(const vector<Technology> &techs, std::uint64_t researchVersion, StateOf &&stateOf)
+    {
+        if (researchVersion == m_researchVersion && techs.size() == m_techCount && techs.data() == m_techData)
+            return;
+
+        if (techs.size() != m_techCount || techs.data() != m_techData)
+            SortByName(techs);
+
+        for (auto &items : m_items)
+            items.clear();
+        for (TechId techId : m_sorted)
+            m_items[static_cast<size_t>(FilterOf(stateOf(techId)))].push_back(techId);
+
+        m_researchVersion = researchVersion;
+        m_rebuildCount++;
+    }
+
+    const vector<TechId> &Items(ResearchFilter filter) const { return m_items[static_cast<size_t>(filter)]; }
+    // Ile razy przebudowano zakładki (diagnostyka).
+    size_t RebuildCount() const { return m_rebuildCount; }
+
+    static ResearchFilter FilterOf(ResearchState state);
+
+private:
+    void SortByName(const vector<Technology> &techs);
+
+private:
+    vector<TechId> m_sorted;
+    std::array<vector<TechId>, RESEARCH_FILTER_COUNT> m_items;
+
+    std::uint64_t m_researchVersion = 0;
+    size_t m_techCount = 0;
+    const Technology *m_techData = nullptr;
+    size_t m_rebuildCount = 0;
+};
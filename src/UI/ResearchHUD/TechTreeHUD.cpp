@@ -1,6 +1,44 @@
 #include "TechTreeHUD.hpp"
+#include <algorithm>
+#include <cmath>
 
-void TechTreeHUD::Draw()
+namespace
+{
+    ImU32 FillColor(const TechStateView& state)
+    {
+        if (state.isCompleted())
+            return IM_COL32(40, 110, 40, 255);
+        if (state.isInProgress())
+            return IM_COL32(110, 90, 30, 255);
+        if (state.isAvailable())
+            return IM_COL32(60, 60, 70, 255);
+        return IM_COL32(35, 35, 38, 255);
+    }
+
+    ImU32 TextColor(const TechStateView& state)
+    {
+        if (state.isCompleted())
+            return IM_COL32(77, 255, 77, 255);
+        if (state.isInProgress())
+            return IM_COL32(255, 217, 102, 255);
+        if (state.isAvailable())
+            return IM_COL32(255, 255, 255, 255);
+        return IM_COL32(128, 128, 128, 255);
+    }
+
+    const char* StateName(const TechStateView& state)
+    {
+        if (state.isCompleted())
+            return "Completed";
+        if (state.isInProgress())
+            return "In progress";
+        if (state.isAvailable())
+            return "Available";
+        return "Locked";
+    }
+}
+
+void TechTreeHUD::Draw(const SimulationStateView& view)
 {
     if (!m_visible)
         return;
@@ -13,53 +51,186 @@ void TechTreeHUD::Draw()
 
     const auto& manager = m_controller.Model();
 
-    for (const auto& [id, tech] : manager.getAllTechnologies())
+    // widok opublikowany przed wczytaniem technologii - nic do rysowania
+    if (view.m_techs.size() != manager.getAllTechnologies().size())
     {
-        if (!tech.m_prerequisites.empty())
-            continue;
+        ImGui::End();
+        return;
+    }
 
-        DrawNode(tech);
+    // układ tylko po wczytaniu nowych danych
+    if (m_layoutVersion != view.m_graphVersion)
+    {
+        m_layout.build(manager);
+        m_layoutVersion = view.m_graphVersion;
+    }
+
+    ImGui::Text("%zu technologies, %u layers", m_layout.nodes().size(), m_layout.layerCount());
+    ImGui::SameLine();
+    ImGui::TextDisabled("(right drag: pan, wheel: zoom, click: research)");
+    ImGui::SameLine();
+    if (ImGui::Button("Reset view"))
+    {
+        m_scroll = ImVec2(20.f, 20.f);
+        m_zoom = 1.f;
+    }
+
+    // --------------------------------------------------------
+    // CANVAS
+    // --------------------------------------------------------
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImVec2 size = ImGui::GetContentRegionAvail();
+    size.x = std::max(size.x, 50.f);
+    size.y = std::max(size.y, 50.f);
+
+    ImGui::InvisibleButton("##canvas", size,
+                           ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonRight |
+                               ImGuiButtonFlags_MouseButtonMiddle);
+    const bool hovered = ImGui::IsItemHovered();
+    const bool active = ImGui::IsItemActive();
+
+    HandleInput(origin, hovered, active);
+
+    // widoczny obszar w jednostkach świata
+    const ImVec2 topLeft = ToWorld(origin, origin);
+    const ImVec2 bottomRight = ToWorld(origin, ImVec2(origin.x + size.x, origin.y + size.y));
+    m_layout.query(LayoutRect{topLeft.x, topLeft.y, bottomRight.x, bottomRight.y},
+                   m_visibleNodes, m_visibleEdges);
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->PushClipRect(origin, ImVec2(origin.x + size.x, origin.y + size.y), true);
+    drawList->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y), IM_COL32(20, 20, 24, 255));
+
+    DrawEdges(drawList, origin, view);
+    DrawNodes(drawList, origin, view);
+
+    drawList->PopClipRect();
+
+    // --------------------------------------------------------
+    // HOVER / CLICK
+    // --------------------------------------------------------
+    if (hovered)
+    {
+        const ImVec2 mouse = ToWorld(origin, ImGui::GetMousePos());
+        if (auto hit = m_layout.hitTest(mouse.x, mouse.y))
+        {
+            DrawNodeTooltip(*hit, view);
+
+            if (ImGui::IsItemClicked(ImGuiMouseButton_Left) && view.m_techs[*hit].isAvailable())
+                m_controller.StartResearch(*hit);
+        }
     }
 
     ImGui::End();
 }
 
-void TechTreeHUD::DrawNode(const Technology& tech)
+void TechTreeHUD::HandleInput(const ImVec2& origin, bool hovered, bool active)
 {
-    const auto& manager = m_controller.Model();
+    const ImGuiIO& io = ImGui::GetIO();
 
-    ImVec4 color =
-        tech.isCompleted()   ? ImVec4(0.3f, 1.f, 0.3f, 1.f) :
-        tech.isInProgress()  ? ImVec4(1.f, 0.85f, 0.4f, 1.f) :
-        manager.isAvailable(tech.m_id)
-            ? ImVec4(1.f, 1.f, 1.f, 1.f)
-            : ImVec4(0.5f, 0.5f, 0.5f, 1.f);
+    if (active && (ImGui::IsMouseDragging(ImGuiMouseButton_Right, 0.f) ||
+                   ImGui::IsMouseDragging(ImGuiMouseButton_Middle, 0.f)))
+    {
+        m_scroll.x += io.MouseDelta.x;
+        m_scroll.y += io.MouseDelta.y;
+    }
 
-    ImGui::PushStyleColor(ImGuiCol_Text, color);
+    // zoom wokół kursora: punkt świata pod myszą zostaje na miejscu
+    if (hovered && io.MouseWheel != 0.f)
+    {
+        const ImVec2 mouse = ImGui::GetMousePos();
+        const ImVec2 anchor = ToWorld(origin, mouse);
 
-    bool open = ImGui::TreeNode(tech.m_name.c_str());
+        m_zoom = std::clamp(m_zoom * std::pow(1.1f, io.MouseWheel), MIN_ZOOM, MAX_ZOOM);
+        m_scroll.x = mouse.x - origin.x - anchor.x * m_zoom;
+        m_scroll.y = mouse.y - origin.y - anchor.y * m_zoom;
+    }
+}
 
-    ImGui::PopStyleColor();
+void TechTreeHUD::DrawEdges(ImDrawList* drawList, const ImVec2& origin, const SimulationStateView& view)
+{
+    const float thickness = std::max(1.f, 1.5f * m_zoom);
 
-    if (ImGui::IsItemClicked() && manager.isAvailable(tech.m_id))
+    for (unsigned index : m_visibleEdges)
     {
-        m_controller.StartResearch(tech.m_id);
+        const TechEdgeLayout& edge = m_layout.edges()[index];
+        const TechNodeLayout& from = m_layout.nodes()[edge.m_from];
+        const TechNodeLayout& to = m_layout.nodes()[edge.m_to];
+
+        const ImVec2 start = ToScreen(origin, from.m_x + TechTreeLayout::NODE_WIDTH,
+                                      from.m_y + TechTreeLayout::NODE_HEIGHT * 0.5f);
+        const ImVec2 end = ToScreen(origin, to.m_x, to.m_y + TechTreeLayout::NODE_HEIGHT * 0.5f);
+
+        const ImU32 color = view.m_techs[edge.m_from].isCompleted()
+                                ? IM_COL32(90, 170, 90, 200)
+                                : IM_COL32(110, 110, 120, 160);
+
+        // ta sama krzywa co TechTreeLayout::edgePoint - zgodna z indeksem przestrzennym
+        const float dx = (end.x - start.x) * 0.5f;
+        drawList->AddBezierCubic(start, ImVec2(start.x + dx, start.y), ImVec2(end.x - dx, end.y), end,
+                                 color, thickness);
     }
+}
 
-    if (!open)
-        return;
+void TechTreeHUD::DrawNodes(ImDrawList* drawList, const ImVec2& origin, const SimulationStateView& view)
+{
+    const auto& manager = m_controller.Model();
+    const float rounding = 4.f * m_zoom;
 
-    for (const auto& [id, child] : manager.getAllTechnologies())
+    for (TechId techId : m_visibleNodes)
     {
-        for (const auto& pre : child.m_prerequisites)
+        const TechNodeLayout& node = m_layout.nodes()[techId];
+        const TechStateView& state = view.m_techs[techId];
+
+        const ImVec2 min = ToScreen(origin, node.m_x, node.m_y);
+        const ImVec2 max = ToScreen(origin, node.m_x + TechTreeLayout::NODE_WIDTH,
+                                    node.m_y + TechTreeLayout::NODE_HEIGHT);
+
+        drawList->AddRectFilled(min, max, FillColor(state), rounding);
+
+        if (state.isInProgress())
+        {
+            const float width = (max.x - min.x) * std::clamp(state.progress(), 0.f, 1.f);
+            drawList->AddRectFilled(ImVec2(min.x, max.y - 4.f * m_zoom), ImVec2(min.x + width, max.y),
+                                    IM_COL32(255, 153, 51, 255));
+        }
+
+        drawList->AddRect(min, max, TextColor(state), rounding);
+
+        if (m_zoom >= LABEL_ZOOM)
         {
-            if (pre == tech.m_id)
-            {
-                DrawNode(child);
-                break;
-            }
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText(ImVec2(min.x + 6.f * m_zoom, min.y + 4.f * m_zoom), TextColor(state),
+                              manager.getTechnology(techId).m_name.c_str());
+            drawList->PopClipRect();
         }
     }
+}
 
-    ImGui::TreePop();
+void TechTreeHUD::DrawNodeTooltip(TechId techId, const SimulationStateView& view)
+{
+    const Technology& tech = m_controller.Model().getTechnology(techId);
+    const TechStateView& state = view.m_techs[techId];
+
+    ImGui::BeginTooltip();
+    ImGui::Text("%s", tech.m_name.c_str());
+    ImGui::Separator();
+    ImGui::Text("State: %s", StateName(state));
+    if (state.isInProgress())
+        ImGui::Text("Progress: %u / %u days", state.m_progressDays, state.m_researchDays);
+    else
+        ImGui::Text("Duration: %u days", tech.m_researchDays);
+    if (state.isAvailable())
+        ImGui::TextDisabled("Click to start research");
+    ImGui::EndTooltip();
+}
+
+ImVec2 TechTreeHUD::ToScreen(const ImVec2& origin, float x, float y) const
+{
+    return ImVec2(origin.x + m_scroll.x + x * m_zoom, origin.y + m_scroll.y + y * m_zoom);
+}
+
+ImVec2 TechTreeHUD::ToWorld(const ImVec2& origin, const ImVec2& screen) const
+{
+    return ImVec2((screen.x - origin.x - m_scroll.x) / m_zoom, (screen.y - origin.y - m_scroll.y) / m_zoom);
 }
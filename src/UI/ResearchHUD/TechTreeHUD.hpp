@@ -1,26 +1,55 @@
 #pragma once
+#include <cstdint>
+#include <vector>
 #include "../IHUD.hpp"
 #include "imgui.h"
 #include "ResearchHUDController.hpp"
+#include "../../Research/TechTreeLayout.hpp"
+#include "../../Simulation/SimulationStateView.hpp"
 
+// Drzewo technologii jako graf na płótnie z przesuwaniem i zoomem.
+// Układ liczony raz po wczytaniu technologii; klatka rysuje tylko węzły
+// i krawędzie z indeksu przestrzennego, które przecinają widok.
 class TechTreeHUD : public IHUD
 {
 public:
+    static const constexpr float MIN_ZOOM = 0.2f;
+    static const constexpr float MAX_ZOOM = 2.5f;
+    // Poniżej tego zoomu nazwy się nie mieszczą - same prostokąty.
+    static const constexpr float LABEL_ZOOM = 0.6f;
+
     explicit TechTreeHUD(ResearchHUDController& controller)
         : m_controller(controller) {}
 
-    void Draw();
+    void Draw(const SimulationStateView& view);
 
     bool IsVisible() const override { return m_visible; }
     void SetVisible(bool v) override { m_visible = v; }
 
 private:
-    void DrawNode(const Technology& tech);
+    void HandleInput(const ImVec2& origin, bool hovered, bool active);
+    void DrawEdges(ImDrawList* drawList, const ImVec2& origin, const SimulationStateView& view);
+    void DrawNodes(ImDrawList* drawList, const ImVec2& origin, const SimulationStateView& view);
+    void DrawNodeTooltip(TechId techId, const SimulationStateView& view);
+
+    ImVec2 ToScreen(const ImVec2& origin, float x, float y) const;
+    ImVec2 ToWorld(const ImVec2& origin, const ImVec2& screen) const;
 
 private:
     ResearchHUDController& m_controller;
     bool m_visible = true;
 
+    TechTreeLayout m_layout;
+    std::uint64_t m_layoutVersion = 0;
+
+    // widok: ekran = początek płótna + m_scroll + świat * m_zoom
+    ImVec2 m_scroll = ImVec2(20.f, 20.f);
+    float m_zoom = 1.f;
+
+    // wynik zapytania o widoczny obszar (pojemność zostaje między klatkami)
+    std::vector<TechId> m_visibleNodes;
+    std::vector<unsigned> m_visibleEdges;
+
     ImGuiWindowFlags m_flags =
         ImGuiWindowFlags_NoCollapse;
 };
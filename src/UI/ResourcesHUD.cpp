@@ -1,8 +1,10 @@
 #include "ResourcesHUD.hpp"
 #include "imgui.h"
+#include <cfloat>
 #include <format>
 
-ResourcesHUD::ResourcesHUD()
+ResourcesHUD::ResourcesHUD(const ResourceConstraints &constraints)
+    : m_constraints(constraints)
 {
     m_highlightUntil = std::chrono::steady_clock::time_point::min();
 }
@@ -31,7 +33,7 @@ void ResourcesHUD::EndHighlightIf(bool condition)
 // =====================================================
 // MAIN DRAW
 // =====================================================
-void ResourcesHUD::Draw(ResourcesManager &manager)
+void ResourcesHUD::Draw(const SimulationStateView &view, CommandQueue &commands)
 {
     UpdateHighlightTimer();
 
@@ -50,25 +52,31 @@ void ResourcesHUD::Draw(ResourcesManager &manager)
     ImGui::Separator();
     ImGui::Spacing();
 
-    DrawMoney(manager);
+    DrawMoney(view, commands);
 
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
 
-    DrawMaterials(manager);
+    DrawMaterials(view);
 
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
 
-    DrawPersonnel(manager);
+    DrawPersonnel(view, commands);
 
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
 
-    DrawFacilityStats(manager);
+    DrawFacilityStats(view);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    DrawForecast(view);
 
     ImGui::End();
 }
@@ -76,47 +84,45 @@ void ResourcesHUD::Draw(ResourcesManager &manager)
 // =====================================================
 // MONEY
 // =====================================================
-void ResourcesHUD::DrawMoney(ResourcesManager &manager)
+void ResourcesHUD::DrawMoney(const SimulationStateView &view, CommandQueue &commands)
 {
-    static int moneyAmount = 1000;
-
     HighlightIf(m_misingResources.money);
-    ImGui::Text("Money: %ld $", manager.getMoney());
+    ImGui::Text("Money: %ld $", view.m_money);
     EndHighlightIf(m_misingResources.money);
 
-    ImGui::InputInt("Amount##money", &moneyAmount);
-    if (moneyAmount < 0)
-        moneyAmount = 0;
+    ImGui::InputInt("Amount##money", &m_moneyInput);
+    if (m_moneyInput < 0)
+        m_moneyInput = 0;
 
     if (ImGui::Button("Add money"))
-        manager.addMoney(moneyAmount);
+        commands.addMoney(m_moneyInput);
 
     ImGui::SameLine();
 
     if (ImGui::Button("Spend money"))
-        manager.spendMoney(moneyAmount);
+        commands.spendMoney(m_moneyInput);
 }
 
 // =====================================================
 // MATERIALS
 // =====================================================
-void ResourcesHUD::DrawMaterials(ResourcesManager &manager)
+void ResourcesHUD::DrawMaterials(const SimulationStateView &view)
 {
     ImGui::Text("Materials");
 
     HighlightIf(m_misingResources.uranium);
-    ImGui::Text("Uranium: %u", manager.getUranium());
+    ImGui::Text("Uranium: %u", view.m_uranium);
     EndHighlightIf(m_misingResources.uranium);
 
     HighlightIf(m_misingResources.plutonium);
-    ImGui::Text("Plutonium: %u", manager.getPlutonium());
+    ImGui::Text("Plutonium: %u", view.m_plutonium);
     EndHighlightIf(m_misingResources.plutonium);
 }
 
 // =====================================================
 // PERSONNEL
 // =====================================================
-void ResourcesHUD::DrawPersonnel(ResourcesManager &manager)
+void ResourcesHUD::DrawPersonnel(const SimulationStateView &view, CommandQueue &commands)
 {
     ImGui::Text("Personnel");
 
@@ -161,47 +167,83 @@ void ResourcesHUD::DrawPersonnel(ResourcesManager &manager)
         EndHighlightIf(highlight);
     };
 
-    // --- Workers ---
-    static int workersInput = 0;
-    row("Workers", m_misingResources.workers, manager.getTotalWorkers(), manager.getWorkingWorkers(), manager.getAvailableToHireWorkers(), workersInput, [&](unsigned v)
-        { manager.hireWorkers(v); }, [&](unsigned v)
-        { manager.fireWorkers(v); });
-
-    // --- Scientists ---
-    static int scientistsInput = 0;
-    row("Scientists", m_misingResources.scientists, manager.getTotalScientists(), manager.getWorkingScientists(), manager.getAvailableToHireScientists(), scientistsInput, [&](unsigned v)
-        { manager.hireScientists(v); }, [&](unsigned v)
-        { manager.fireScientists(v); });
-
-    // --- Engineers ---
-    static int engineersInput = 0;
-    row("Engineers", m_misingResources.engineers, manager.getTotalEngineers(), manager.getWorkingEngineers(), manager.getAvailableToHireEngineers(), engineersInput, [&](unsigned v)
-        { manager.hireEngineers(v); }, [&](unsigned v)
-        { manager.fireEngineers(v); });
-
-    // --- Army ---
-    static int armyInput = 0;
-    row("Army Personnel", m_misingResources.army, manager.getTotalArmyPersonnel(), manager.getWorkingArmyPersonnel(), manager.getAvailableToHireArmyPersonnel(), armyInput, [&](unsigned v)
-        { manager.hireArmyPersonnel(v); }, [&](unsigned v)
-        { manager.fireArmyPersonnel(v); });
+    const bool highlights[PERSONNEL_ROLE_COUNT] = {
+        m_misingResources.workers,
+        m_misingResources.scientists,
+        m_misingResources.engineers,
+        m_misingResources.army};
+
+    for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+    {
+        const PersonnelRole role = static_cast<PersonnelRole>(i);
+
+        row(personnelRoleName(role), highlights[i], view.m_totalPersonnel[i], view.m_workingPersonnel[i], view.availableToHire(role), m_personnelInput[i], [&](unsigned v)
+            { commands.hire(role, v); }, [&](unsigned v)
+            { commands.fire(role, v); });
+    }
 }
 
 // =====================================================
 // FACILITY STATS
 // =====================================================
-void ResourcesHUD::DrawFacilityStats(ResourcesManager &manager)
+void ResourcesHUD::DrawFacilityStats(const SimulationStateView &view)
 {
     ImGui::Text("Facility Stats");
 
-    float morale = manager.getMorale() / 100.0f;
+    float morale = view.m_morale / static_cast<float>(m_constraints.maximal_total_morale);
     ImGui::Text("Morale");
     ImGui::ProgressBar(morale, ImVec2(-1, 0));
 
-    float security = manager.getSecurity() / 100.0f;
+    float security = view.m_security / static_cast<float>(m_constraints.maximal_total_security);
     ImGui::Text("Security");
     ImGui::ProgressBar(security, ImVec2(-1, 0));
 }
 
+// =====================================================
+// FORECAST
+// =====================================================
+void ResourcesHUD::DrawForecast(const SimulationStateView &view)
+{
+    const auto &forecast = view.m_forecast;
+    const BudgetForecastSummary &summary = view.m_forecastSummary;
+    ImGui::Text("Forecast (%zu days)", forecast.size());
+
+    // serie dla wykresów tylko po nowej publikacji
+    if (m_forecastVersion != view.m_version)
+    {
+        m_forecastVersion = view.m_version;
+        m_moneySeries.resize(forecast.size());
+        m_moraleSeries.resize(forecast.size());
+        m_securitySeries.resize(forecast.size());
+        for (size_t i = 0; i < forecast.size(); ++i)
+        {
+            m_moneySeries[i] = static_cast<float>(forecast[i].m_money);
+            m_moraleSeries[i] = static_cast<float>(forecast[i].m_morale);
+            m_securitySeries[i] = static_cast<float>(forecast[i].m_security);
+        }
+    }
+
+    ImGui::Text("Daily cost: %ld $ (research: %ld $)", view.m_dailyCost, view.m_researchDailyCost);
+    ImGui::Text("Cost over forecast: %ld $", summary.m_totalCost);
+
+    HighlightIf(summary.m_firstInsolventDay.has_value());
+    if (summary.m_firstInsolventDay)
+        ImGui::Text("Money runs out in %u days", *summary.m_firstInsolventDay);
+    else
+        ImGui::Text("Money lasts the whole forecast");
+    if (summary.m_moraleDepletedDay)
+        ImGui::Text("Morale depleted in %u days", *summary.m_moraleDepletedDay);
+    EndHighlightIf(summary.m_firstInsolventDay.has_value());
+
+    const int count = static_cast<int>(m_moneySeries.size());
+    const ImVec2 graphSize(-1, 60);
+    ImGui::PlotLines("Money", m_moneySeries.data(), count, 0, nullptr, FLT_MAX, FLT_MAX, graphSize);
+    ImGui::PlotLines("Morale", m_moraleSeries.data(), count, 0, nullptr,
+                     m_constraints.minimal_total_morale, m_constraints.maximal_total_morale, graphSize);
+    ImGui::PlotLines("Security", m_securitySeries.data(), count, 0, nullptr,
+                     m_constraints.minimal_total_security, m_constraints.maximal_total_security, graphSize);
+}
+
 // =====================================================
 // EVENT FROM RESEARCH MANAGER
 // =====================================================
@@ -218,6 +260,11 @@ void ResourcesHUD::OnResearchMissingResources(
 // =====================================================
 // TIMER
 // =====================================================
+bool ResourcesHUD::IsHighlightActive() const
+{
+    return std::chrono::steady_clock::now() <= m_highlightUntil;
+}
+
 void ResourcesHUD::UpdateHighlightTimer()
 {
     if (std::chrono::steady_clock::now() > m_highlightUntil)
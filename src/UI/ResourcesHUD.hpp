@@ -1,37 +1,55 @@
 #pragma once
 #include <chrono>
+#include <cstdint>
+#include <vector>
 #include "imgui.h"
-#include "../Resources/ResourcesManager.hpp"
-#include "../Research/ResearchManager.hpp"
+#include "../Resources/ResourceConstraints.hpp"
+#include "../Simulation/CommandQueue.hpp"
+#include "../Simulation/SimulationStateView.hpp"
 #include "IHUD.hpp"
 
 class ResourcesHUD : public IHUD
 {
 public:
-    ResourcesHUD();
+    explicit ResourcesHUD(const ResourceConstraints &constraints);
 
-    void Draw(ResourcesManager &manager);
+    // Odczyt z opublikowanego widoku stanu, zmiany wyłącznie przez kolejkę komend (log powtórek).
+    void Draw(const SimulationStateView &view, CommandQueue &commands);
     void OnResearchMissingResources(
         const ResourceMissing &missing);
+    // Czerwone podświetlenie braków jeszcze trwa - pętla musi rysować klatki, żeby je zgasić.
+    bool IsHighlightActive() const;
     bool IsVisible() const override { return m_visible; }
     void SetVisible(bool v) override { m_visible = v; }
 
 private:
-    void DrawMoney(ResourcesManager &manager);
-    void DrawMaterials(ResourcesManager &manager);
-    void DrawPersonnel(ResourcesManager &manager);
-    void DrawFacilityStats(ResourcesManager &manager);
+    void DrawMoney(const SimulationStateView &view, CommandQueue &commands);
+    void DrawMaterials(const SimulationStateView &view);
+    void DrawPersonnel(const SimulationStateView &view, CommandQueue &commands);
+    void DrawFacilityStats(const SimulationStateView &view);
+    // Prognoza przychodzi gotowa w widoku; serie wykresów przeliczane po nowej publikacji.
+    void DrawForecast(const SimulationStateView &view);
 
     static void HighlightIf(bool condition);
     static void EndHighlightIf(bool condition);
     void UpdateHighlightTimer();
 
 private:
+    const ResourceConstraints &m_constraints;
     ResourceMissing m_misingResources;
 
     std::chrono::steady_clock::time_point m_highlightUntil;
     bool m_visible = true;
 
+    // Wartości pól "Amount" (stan widoku, nie statyczne zmienne funkcji).
+    int m_moneyInput = 1000;
+    int m_personnelInput[PERSONNEL_ROLE_COUNT] = {};
+
+    std::uint64_t m_forecastVersion = 0;
+    std::vector<float> m_moneySeries;
+    std::vector<float> m_moraleSeries;
+    std::vector<float> m_securitySeries;
+
     ImGuiWindowFlags m_flags =
         ImGuiWindowFlags_NoCollapse;
 };
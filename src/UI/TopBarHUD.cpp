@@ -23,6 +23,22 @@ void TopBarHUD::Draw(UIVisibility& ui)
     ImGui::Checkbox("Tech Tree", &ui.showTechTree);
     ImGui::SameLine();
     ImGui::Checkbox("Resources", &ui.showResources);
+    ImGui::SameLine();
+    ImGui::Checkbox("Profiler", &ui.showProfiler);
+    ImGui::SameLine();
+
+    // limit klatek - na bezczynności i tak nic się nie rysuje
+    static const char* const frameCapNames[] = {"30 FPS", "60 FPS", "120 FPS", "Unlimited"};
+    static const unsigned frameCaps[] = {30, 60, 120, 0};
+    int frameCapIndex = 1;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (frameCaps[i] == ui.frameCap)
+            frameCapIndex = i;
+    }
+    ImGui::SetNextItemWidth(100);
+    if (ImGui::Combo("##frameCap", &frameCapIndex, frameCapNames, 4))
+        ui.frameCap = frameCaps[frameCapIndex];
 
     ImGui::End();
 }
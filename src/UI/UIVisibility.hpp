@@ -6,10 +6,15 @@ struct UIVisibility
     bool showResearch   = true;
     bool showTechTree   = true;
     bool showResources  = true;
+    bool showProfiler   = false;
 
     // stany poprzednie (do detekcji zmian)
     bool lastDate       = showDate;
     bool lastResearch   = showResearch;
     bool lastTechTree   = showTechTree;
     bool lastResources  = showResources;
+    bool lastProfiler   = showProfiler;
+
+    // limit klatek pętli okna (0 = bez limitu)
+    unsigned frameCap   = 60;
 };
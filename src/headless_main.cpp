@@ -0,0 +1,271 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "Resources/ResourceConstraints.hpp"
+#include "Simulation/SimulationWorld.hpp"
+#include "Simulation/CampaignScript.hpp"
+#include "Simulation/MonteCarloSweep.hpp"
+#include "Simulation/Replay.hpp"
+#include "Research/ResearchScheduler.hpp"
+
+using std::cerr;
+using std::cout;
+using std::string;
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+namespace
+{
+    void printUsage(const char *program)
+    {
+        cerr << "Usage: " << program << " [--randomized] [runs] [data_dir]\n"
+             << "       " << program << " --sweep <campaigns> [--threads <n>] [--seed <s>] [--randomized] [data_dir]\n"
+             << "       " << program << " --replay <session.mcl> [data_dir]\n"
+             << "       " << program << " --plan <tech_id> [data_dir]\n";
+    }
+
+    void printHistogram(const char *title, const Histogram &histogram)
+    {
+        cout << title << " (" << histogram.total() << " samples, "
+             << histogram.m_underflow << " below, " << histogram.m_overflow << " above)\n";
+
+        for (size_t i = 0; i < histogram.m_counts.size(); ++i)
+        {
+            if (histogram.m_counts[i] == 0)
+                continue;
+
+            const double from = histogram.m_min + i * histogram.binWidth();
+            cout << "  [" << from << ", " << from + histogram.binWidth() << "): "
+                 << histogram.m_counts[i] << "\n";
+        }
+    }
+
+    // Kolejne kampanie jedna po drugiej - pomiar przepustowości pojedynczego rdzenia.
+    int runSequential(const ResourceConstraints &constraints, const string &technologiesPath,
+                      unsigned long runs, ResearchOutcomeMode outcomeMode)
+    {
+        Seconds setupTime{0};
+        Seconds simulationTime{0};
+        unsigned long long totalDays = 0;
+        unsigned long moraleGameOvers = 0;
+        CampaignResult last;
+
+        const auto wallStart = Clock::now();
+
+        for (unsigned long run = 0; run < runs; ++run)
+        {
+            const auto setupStart = Clock::now();
+            SimulationWorld world(constraints, technologiesPath, run, outcomeMode);
+            const auto simulationStart = Clock::now();
+
+            last = runScriptedCampaign(world);
+
+            const auto simulationEnd = Clock::now();
+            setupTime += simulationStart - setupStart;
+            simulationTime += simulationEnd - simulationStart;
+
+            totalDays += last.daysSimulated;
+            if (last.moraleDepleted)
+                moraleGameOvers++;
+        }
+
+        const Seconds wallTime = Clock::now() - wallStart;
+
+        cout << "Campaigns:            " << runs << "\n";
+        cout << "Simulated days:       " << totalDays << "\n";
+        cout << "Wall time:            " << wallTime.count() << " s\n";
+        cout << "  setup (data load):  " << setupTime.count() << " s\n";
+        cout << "  simulation:         " << simulationTime.count() << " s\n";
+        cout << "Days/second (sim):    " << (simulationTime.count() > 0 ? totalDays / simulationTime.count() : 0.0) << "\n";
+        cout << "Days/second (wall):   " << (wallTime.count() > 0 ? totalDays / wallTime.count() : 0.0) << "\n";
+        cout << "Morale game overs:    " << moraleGameOvers << "\n";
+        cout << "Last campaign:        " << last.completedTechnologies << " techs, last completed on day "
+             << last.lastCompletionDay << ", money " << last.finalMoney << "\n";
+
+        return 0;
+    }
+
+    // Monte Carlo: wiele niezależnych kampanii na wszystkich rdzeniach.
+    int runSweep(const ResourceConstraints &constraints, const string &technologiesPath,
+                 const SweepConfig &config)
+    {
+        // Dane wczytywane raz - światy kopiują gotowy prototyp.
+        TimeDataModel prototypeTime;
+        ResourceConstraints prototypeConstraints = constraints;
+        ResourcesManager prototypeResources(prototypeConstraints, prototypeTime);
+        ResearchManager prototype(prototypeTime, prototypeResources);
+        prototype.loadFromJsonCached(technologiesPath);
+
+        const auto wallStart = Clock::now();
+        SweepResult result = runMonteCarloSweep(constraints, prototype.getAllTechnologies(), config);
+        const Seconds wallTime = Clock::now() - wallStart;
+
+        cout << "Campaigns:            " << result.campaigns << "\n";
+        cout << "Wall time:            " << wallTime.count() << " s\n";
+        cout << "Campaigns/second:     " << (wallTime.count() > 0 ? result.campaigns / wallTime.count() : 0.0) << "\n";
+        cout << "Morale game overs:    " << result.moraleGameOvers << "\n";
+        cout << "All research done:    " << result.allResearchCompleted << "\n";
+        printHistogram("Day of final tech completion", result.finalCompletionDay);
+        printHistogram("Money at end", result.finalMoney);
+
+        return 0;
+    }
+
+    // Odtworzenie logu komend z gry i weryfikacja skrótów stanu.
+    int runReplay(const string &logPath, const string &technologiesPath)
+    {
+        CommandLog log;
+        if (!log.loadFromFile(logPath))
+        {
+            cerr << "Invalid command log: " << logPath << "\n";
+            return 1;
+        }
+
+        TimeDataModel prototypeTime;
+        ResourceConstraints prototypeConstraints;
+        ResourcesManager prototypeResources(prototypeConstraints, prototypeTime);
+        ResearchManager prototype(prototypeTime, prototypeResources);
+        prototype.loadFromJsonCached(technologiesPath);
+
+        const auto wallStart = Clock::now();
+        ReplayResult result = replayCommandLog(log, prototype.getAllTechnologies());
+        const Seconds wallTime = Clock::now() - wallStart;
+
+        cout << "Commands:             " << result.commandsExecuted << " / " << log.commands().size() << "\n";
+        cout << "Checkpoints verified: " << result.checkpointsVerified << "\n";
+        cout << "Wall time:            " << wallTime.count() << " s\n";
+        cout << "Final state hash:     " << std::hex << result.finalHash << std::dec << "\n";
+
+        if (result.desynced)
+        {
+            cout << "DESYNC: " << result.error << "\n";
+            return 2;
+        }
+
+        cout << "Replay OK\n";
+        return 0;
+    }
+
+    // Najkrótsza droga do technologii od startu kampanii, gdy zatrudniony jest cały dostępny personel.
+    int runPlan(const ResourceConstraints &constraints, const string &technologiesPath, const string &techId)
+    {
+        SimulationWorld world(constraints, technologiesPath);
+        const auto target = world.research().findTechnology(techId);
+        if (!target.has_value())
+        {
+            cerr << "Unknown technology: " << techId << "\n";
+            return 1;
+        }
+
+        ResearchScheduler scheduler(world.time(), world.research(), world.resources());
+        const auto wallStart = Clock::now();
+        const TechTiming timing = scheduler.timing(*target);
+        const vector<TechId> path = scheduler.criticalPath(*target);
+        SchedulerLimits limits;
+        for (size_t i = 0; i < PERSONNEL_ROLE_COUNT; ++i)
+            limits.m_personnel[i] = world.resources().getTotal(static_cast<PersonnelRole>(i));
+        const ResearchSchedule schedule = scheduler.planSchedule(*target, limits);
+        const Seconds wallTime = Clock::now() - wallStart;
+
+        if (!timing.m_reachable)
+        {
+            cout << techId << " is unreachable\n";
+            return 2;
+        }
+
+        cout << "Critical path (unlimited personnel), done on day " << timing.m_earliestFinish << ":\n";
+        for (TechId id : path)
+        {
+            const TechTiming step = scheduler.timing(id);
+            cout << "  " << world.research().getTechnology(id).m_id << "  day " << step.m_earliestStart
+                 << " -> " << step.m_earliestFinish << "\n";
+        }
+
+        if (!schedule.m_feasible)
+        {
+            cout << "Not achievable with the available personnel\n";
+            return 2;
+        }
+
+        cout << "Schedule with available personnel, done on day " << schedule.m_finishDay << ":\n";
+        for (const auto &entry : schedule.m_entries)
+        {
+            cout << "  " << world.research().getTechnology(entry.m_techId).m_id << "  day " << entry.m_startDay
+                 << " -> " << entry.m_finishDay << "\n";
+        }
+        cout << "Solver time:          " << wallTime.count() << " s\n";
+        return 0;
+    }
+}
+
+// Headless runner: gra kampanie do MAX_GAME_DAY bez SDL/OpenGL/ImGui
+// i raportuje przepustowość symulacji.
+int main(int argc, char **argv)
+{
+    unsigned long runs = 1;
+    bool sweep = false;
+    string replayPath;
+    string planTechId;
+    SweepConfig sweepConfig;
+    string dataDir = "./../data";
+
+    int positional = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--sweep") == 0 && hasValue)
+        {
+            sweep = true;
+            sweepConfig.campaigns = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && hasValue)
+            replayPath = argv[++i];
+        else if (std::strcmp(argv[i], "--plan") == 0 && hasValue)
+            planTechId = argv[++i];
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            sweepConfig.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+            sweepConfig.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--randomized") == 0)
+            sweepConfig.outcomeMode = ResearchOutcomeMode::Randomized;
+        else if (argv[i][0] == '-')
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+        else if (!sweep && replayPath.empty() && planTechId.empty() && positional == 0)
+        {
+            runs = std::strtoul(argv[i], nullptr, 10);
+            positional++;
+        }
+        else
+            dataDir = argv[i];
+    }
+
+    if (runs == 0 || (sweep && sweepConfig.campaigns == 0))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (!replayPath.empty())
+        return runReplay(replayPath, dataDir + "/technologies.json");
+
+    ResourceConstraints constraints;
+    if (!constraints.loadFromJsonCached(dataDir + "/resource_constraints_normal.json"))
+        return 1;
+
+    const string technologiesPath = dataDir + "/technologies.json";
+
+    if (!planTechId.empty())
+        return runPlan(constraints, technologiesPath, planTechId);
+
+    if (sweep)
+        return runSweep(constraints, technologiesPath, sweepConfig);
+
+    return runSequential(constraints, technologiesPath, runs, sweepConfig.outcomeMode);
+}
@@ -2,8 +2,15 @@
 #include <SDL3/SDL_opengl.h>
 
 #include "Core/header/TimeSystem.hpp"
+#include "Core/header/Profiler.hpp"
+#include "Core/header/RenderScheduler.hpp"
 #include "Research/ResearchManager.hpp"
 #include "Resources/ResourcesManager.hpp"
+#include "Simulation/CommandDispatcher.hpp"
+#include "Simulation/CommandLog.hpp"
+#include "Simulation/CommandQueue.hpp"
+#include "Simulation/SimulationThread.hpp"
+#include "Simulation/SimulationStateView.hpp"
 
 #include "imgui.h"
 #include "backends/imgui_impl_sdl3.h"
@@ -15,6 +22,7 @@
 #include "UI/TopBarHUD.hpp"
 #include "UI/DateHUD.hpp"
 #include "UI/ResourcesHUD.hpp"
+#include "UI/ProfilerHUD.hpp"
 
 // Research MVC
 #include "UI/ResearchHUD/ResearchHUDController.hpp"
@@ -35,6 +43,8 @@ int main()
         SDL_WINDOW_OPENGL);
 
     SDL_GLContext gl_context = SDL_GL_CreateContext(window);
+    // vsync - nawet bez limitu klatek nie rysujemy szybciej niż odświeża ekran
+    SDL_GL_SetSwapInterval(1);
 
     // =======================
     // IMGUI
@@ -43,7 +53,6 @@ int main()
     ImGui::CreateContext();
 
     ImGuiIO &io = ImGui::GetIO();
-    (void)io;
 
     ImGui_ImplSDL3_InitForOpenGL(window, gl_context);
     ImGui_ImplOpenGL3_Init("#version 150");
@@ -54,7 +63,7 @@ int main()
     TimeDataModel timeModel;
 
     ResourceConstraints resourceConstraints;
-    resourceConstraints.loadFromJson(
+    resourceConstraints.loadFromJsonCached(
         "./../data/resource_constraints_normal.json");
 
     ResourcesManager resourcesManager(
@@ -65,9 +74,47 @@ int main()
         timeModel,
         resourcesManager);
 
-    researchManager.loadFromJson(
+    researchManager.loadFromJsonCached(
         "./../data/technologies.json");
 
+    // =======================
+    // COMMANDS + REPLAY LOG
+    // =======================
+    // Każda zmiana stanu z UI trafia do logu, który ManhattanHeadless --replay
+    // odtwarza i weryfikuje skrótem stanu.
+    CommandLog commandLog;
+    commandLog.begin(resourceConstraints, timeModel, resourcesManager, researchManager);
+    commandLog.openFile("./session.mcl");
+
+    CommandDispatcher commands(timeModel, resourcesManager, researchManager);
+    commands.setLog(&commandLog);
+
+    // =======================
+    // STATE VIEWS
+    // =======================
+    // HUD-y czytają wyłącznie opublikowane widoki stanu (potrójny bufor, bez blokad),
+    // więc symulacja może tykać niezależnie od pętli rysowania.
+    StateViewPublisher statePublisher(timeModel, resourcesManager, researchManager);
+    statePublisher.publish();
+
+    // =======================
+    // SIMULATION THREAD
+    // =======================
+    // Od start() stan gry zmienia wyłącznie wątek symulacji: UI wysyła komendy
+    // przez kolejkę SPSC, odbiera widoki stanu i zdarzenia (pollEvent).
+    CommandQueue commandQueue;
+    SimulationThread simulation(timeModel, researchManager, commands, commandQueue, statePublisher);
+
+    // nowy widok budzi pętlę okna śpiącą w SDL_WaitEventTimeout
+    const Uint32 simulationWakeEvent = SDL_RegisterEvents(1);
+    simulation.setPublishedCallback(
+        [simulationWakeEvent]()
+        {
+            SDL_Event wake{};
+            wake.type = simulationWakeEvent;
+            SDL_PushEvent(&wake);
+        });
+
     // =======================
     // UI STATE
     // =======================
@@ -78,68 +125,141 @@ int main()
     // =======================
     TopBarHUD topBarHUD;
     DateHUD dateHUD;
-    ResourcesHUD resourcesHUD;
+    ResourcesHUD resourcesHUD(resourceConstraints);
     ResearchCompletedPopupHUD researchPopUpHUD;
+    ProfilerHUD profilerHUD;
+
+    // pomiar klatek i poszczególnych HUD-ów (okno Profiler)
+    FrameProfiler profiler;
 
     // =======================
     // RESEARCH MVC
     // =======================
-    ResearchHUDController researchController(researchManager,researchPopUpHUD);
+    ResearchHUDController researchController(researchManager, commandQueue, researchPopUpHUD);
 
     ResearchListHUD researchListHUD(researchController);
     TechTreeHUD techTreeHUD(researchController);
 
-    // brak surowców → ResourcesHUD
-    researchManager.addResearchMissingResourcesListener(
-        [&](const ResourceMissing &missing)
-        {
-            resourcesHUD.OnResearchMissingResources(missing);
-        });
-
     // =======================
     // MAIN LOOP
     // =======================
+    // Klatka tylko na żądanie (wejście, nowy widok stanu, animacja), w limicie
+    // klatek; w przeciwnym razie wątek śpi w SDL_WaitEventTimeout.
+    RenderScheduler renderScheduler(ui.frameCap);
+
+    simulation.start();
+
     bool running = true;
     while (running)
     {
         SDL_Event event;
-        while (SDL_PollEvent(&event))
+        if (SDL_WaitEventTimeout(&event, renderScheduler.waitTimeoutMs(RenderScheduler::Clock::now())))
         {
-            ImGui_ImplSDL3_ProcessEvent(&event);
-            if (event.type == SDL_EVENT_QUIT)
-                running = false;
+            do
+            {
+                ImGui_ImplSDL3_ProcessEvent(&event);
+                if (event.type == SDL_EVENT_QUIT)
+                    running = false;
+            } while (SDL_PollEvent(&event));
+
+            renderScheduler.requestRedraw(RenderScheduler::INPUT_REDRAW_FRAMES);
         }
 
+        // nowy dzień, ukończone badanie, zmiana zasobów
+        if (statePublisher.hasFresh())
+            renderScheduler.requestRedraw();
+
+        const auto frameStart = RenderScheduler::Clock::now();
+        if (!running || !renderScheduler.shouldRender(frameStart))
+            continue;
+
+        renderScheduler.beginFrame(frameStart);
+        profiler.beginFrame();
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplSDL3_NewFrame();
         ImGui::NewFrame();
 
+        // jeden widok na całą klatkę - wszystkie HUD-y widzą ten sam stan
+        const SimulationStateView &view = statePublisher.acquire();
+        // tick liczy się na wątku symulacji - do profilera trafia czas z widoku
+        profiler.addSample("Simulation tick", view.m_tickMs);
+
+        // zdarzenia modelu z wątku symulacji
+        SimulationEvent simulationEvent;
+        while (simulation.pollEvent(simulationEvent))
+        {
+            switch (simulationEvent.m_type)
+            {
+            case SimulationEventType::ResearchCompleted:
+                researchController.OnResearchCompleted(simulationEvent.m_techId);
+                break;
+            case SimulationEventType::ResearchMissingResources:
+                // brak surowców → ResourcesHUD
+                resourcesHUD.OnResearchMissingResources(simulationEvent.m_missing);
+                break;
+            }
+        }
+
         // =======================
         // DRAW HUDs
         // =======================
-        topBarHUD.Draw(ui);
+        {
+            ScopedTimer timer(profiler, "TopBarHUD");
+            topBarHUD.Draw(ui);
+        }
 
         // 🔁 Synchronizacja widoczności (JEDYNE MIEJSCE)
         SyncVisibility(ui.showDate, ui.lastDate, dateHUD);
         SyncVisibility(ui.showResearch, ui.lastResearch, researchListHUD);
         SyncVisibility(ui.showTechTree, ui.lastTechTree, techTreeHUD);
         SyncVisibility(ui.showResources, ui.lastResources, resourcesHUD);
+        SyncVisibility(ui.showProfiler, ui.lastProfiler, profilerHUD);
 
         // =======================
         // Rysowanie
         // =======================
         if (ui.showDate)
-            dateHUD.Draw(timeModel);
+        {
+            ScopedTimer timer(profiler, "DateHUD");
+            dateHUD.Draw(view, simulation.speed());
+        }
 
         if (ui.showResearch)
-            researchListHUD.Draw();
+        {
+            ScopedTimer timer(profiler, "ResearchListHUD");
+            researchListHUD.Draw(view);
+        }
 
         if (ui.showTechTree)
-            techTreeHUD.Draw();
+        {
+            ScopedTimer timer(profiler, "TechTreeHUD");
+            techTreeHUD.Draw(view);
+        }
 
         if (ui.showResources)
-            resourcesHUD.Draw(resourcesManager);
-        researchPopUpHUD.Draw();
+        {
+            ScopedTimer timer(profiler, "ResourcesHUD");
+            resourcesHUD.Draw(view, commandQueue);
+        }
+
+        {
+            ScopedTimer timer(profiler, "ResearchCompletedPopupHUD");
+            researchPopUpHUD.Draw();
+        }
+
+        if (ui.showProfiler)
+            profilerHUD.Draw(profiler);
+
+        // =======================
+        // SIMULATION CONTROL
+        // =======================
+        // czas przesuwa wątek symulacji; wynik wróci jako nowy widok stanu
+        if (unsigned short days = dateHUD.TakeRequestedDays())
+            commandQueue.advanceDays(days);
+
+        if (auto speed = dateHUD.TakeRequestedSpeed())
+            simulation.setSpeed(*speed);
 
         // =======================
         // RENDER
@@ -154,15 +274,29 @@ int main()
         glClearColor(0.f, 0.f, 0.f, 1.f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        ImGui_ImplOpenGL3_RenderDrawData(
-            ImGui::GetDrawData());
+        {
+            ScopedTimer timer(profiler, "RenderDrawData");
+            ImGui_ImplOpenGL3_RenderDrawData(
+                ImGui::GetDrawData());
+        }
 
         SDL_GL_SwapWindow(window);
+
+        profiler.endFrame();
+
+        // migający kursor w polu tekstowym i gasnące podświetlenie braków wymagają kolejnych klatek
+        renderScheduler.setAnimating(io.WantTextInput || resourcesHUD.IsHighlightActive());
+        renderScheduler.setFrameCap(ui.frameCap);
     }
 
     // =======================
     // CLEANUP
     // =======================
+    // wątek symulacji zatrzymany - dispatcher znów należy do tego wątku;
+    // końcowy skrót stanu - odtworzenie musi do niego dojść
+    simulation.stop();
+    commands.checkpoint();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
     ImGui::DestroyContext();
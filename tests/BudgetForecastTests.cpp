@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "Resources/BudgetForecast.hpp"
+#include "Resources/ResourcesManager.hpp"
+#include "Research/ResearchManager.hpp"
+#include "Core/header/TimeSystem.hpp"
+#include "TestTechnologies.hpp"
+
+using namespace std;
+
+class BudgetForecastTest : public ::testing::Test
+{
+protected:
+    TimeDataModel timeModel;
+    ResourceConstraints constraints;
+    ResourcesManager resources;
+    ResearchManager research;
+
+    BudgetForecastTest()
+        : resources(constraints, timeModel),
+          research(timeModel, resources)
+    {
+        resources.setTotalScientists(100);
+        resources.hireScientists(100);
+        research.loadTechnologies({makeTech("short", 5, {}, {.scientists = 10, .dailyCost = 300}),
+                                   makeTech("long", 12, {}, {.scientists = 10, .dailyCost = 150})});
+    }
+
+    BudgetForecast currentForecast() const
+    {
+        BudgetForecast forecast(resources);
+        research.addResearchCosts(forecast);
+        return forecast;
+    }
+};
+
+/* -------------------------------------------------- */
+
+TEST_F(BudgetForecastTest, ResearchDailyCostIsCharged)
+{
+    const long personnel = static_cast<long>(resources.dailyPersonnelCost());
+    ASSERT_TRUE(research.startResearch("short"));
+    EXPECT_EQ(resources.getResearchDailyCost(), 300);
+
+    const long before = resources.getMoney();
+    timeModel.nextDay();
+    EXPECT_EQ(resources.getMoney(), before - personnel - 300);
+
+    timeModel.advanceDays(4);
+    ASSERT_TRUE(research.isCompleted("short"));
+    EXPECT_EQ(resources.getResearchDailyCost(), 0);
+}
+
+TEST_F(BudgetForecastTest, SeriesMatchesDayByDaySimulation)
+{
+    ASSERT_TRUE(research.startResearch("short"));
+    ASSERT_TRUE(research.startResearch("long"));
+
+    const unsigned short days = 120;
+    vector<BudgetLevels> series;
+    currentForecast().projectSeries(days, series);
+    ASSERT_EQ(series.size(), days);
+
+    for (unsigned short day = 0; day < days; ++day)
+    {
+        timeModel.nextDay();
+        ASSERT_EQ(series[day].m_money, resources.getMoney()) << "day " << day + 1;
+        ASSERT_EQ(series[day].m_morale, resources.getMorale()) << "day " << day + 1;
+        ASSERT_EQ(series[day].m_security, resources.getSecurity()) << "day " << day + 1;
+    }
+}
+
+TEST_F(BudgetForecastTest, SummaryReportsInsolvencyAndMoraleDepletion)
+{
+    ASSERT_TRUE(research.startResearch("short"));
+
+    const unsigned short days = 200;
+    const BudgetForecast forecast = currentForecast();
+    const BudgetForecastSummary summary = forecast.project(days);
+    vector<BudgetLevels> series;
+    forecast.projectSeries(days, series);
+
+    EXPECT_EQ(summary.m_final.m_money, series.back().m_money);
+    EXPECT_EQ(summary.m_totalCost, resources.getMoney() - series.back().m_money);
+
+    ASSERT_TRUE(summary.m_firstInsolventDay.has_value());
+    const unsigned short insolvent = *summary.m_firstInsolventDay;
+    EXPECT_GT(series[insolvent - 2].m_money, 0);
+    EXPECT_LE(series[insolvent - 1].m_money, 0);
+
+    ASSERT_TRUE(summary.m_moraleDepletedDay.has_value());
+    const unsigned short depleted = *summary.m_moraleDepletedDay;
+    EXPECT_GT(series[depleted - 2].m_morale, constraints.minimal_total_morale);
+    EXPECT_EQ(series[depleted - 1].m_morale, constraints.minimal_total_morale);
+}
+
+TEST(BudgetForecast, PlannedCostsAndExpensesSplitPieces)
+{
+    ResourceConstraints constraints;
+    BudgetForecast forecast(BudgetLevels{1000, 50, 50}, 10, constraints);
+    forecast.addCostInterval(3, 4, 100);
+    forecast.addExpense(6, 500);
+
+    vector<BudgetLevels> series;
+    forecast.projectSeries(7, series);
+    const vector<long> expected = {990, 980, 870, 760, 750, 240, 230};
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(series[i].m_money, expected[i]) << "day " << i + 1;
+
+    const BudgetForecastSummary summary = forecast.project(7);
+    EXPECT_EQ(summary.m_totalCost, 770);
+    EXPECT_FALSE(summary.m_firstInsolventDay.has_value());
+    EXPECT_EQ(summary.m_final.m_morale, 57u);
+}
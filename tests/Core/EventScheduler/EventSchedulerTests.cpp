@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "Core/header/EventScheduler.hpp"
+#include "Simulation/SimulationWorld.hpp"
+#include "../../TestTechnologies.hpp"
+
+namespace
+{
+    vector<Technology> makeTechnologies()
+    {
+        const TechOptions options{.scientists = 10, .moneyCost = 500};
+        return {makeTech("a", 17, {}, options), makeTech("b", 45, {"a"}, options),
+                makeTech("c", 3, {"a"}, options), makeTech("d", 120, {"b", "c"}, options),
+                makeTech("e", 61, {}, options)};
+    }
+
+    // Scenariusz reagujący tylko na zdarzenia: gdy nic nie jest badane,
+    // startuje pierwszą dostępną technologię (wg id).
+    void react(SimulationWorld &world)
+    {
+        auto &research = world.research();
+        if (research.getActiveResearch() != nullptr)
+            return;
+
+        vector<string> ids;
+        for (const auto &tech : research.getAllTechnologies())
+            ids.push_back(tech.m_id.str());
+        std::sort(ids.begin(), ids.end());
+
+        for (const auto &id : ids)
+        {
+            if (research.isAvailable(id) && research.startResearch(id))
+                return;
+        }
+    }
+
+    void prepare(SimulationWorld &world)
+    {
+        // mało pieniędzy: saldo przejdzie przez zero, a morale spadnie do minimum
+        world.resources().hireScientists(50);
+        world.resources().hireWorkers(2000);
+    }
+
+    void expectSameState(SimulationWorld &a, SimulationWorld &b)
+    {
+        EXPECT_EQ(a.time().currentGameDay(), b.time().currentGameDay());
+        EXPECT_EQ(a.time().currentDayOfWeek(), b.time().currentDayOfWeek());
+        EXPECT_EQ(a.time().currentDate().day(), b.time().currentDate().day());
+        EXPECT_EQ(a.time().currentDate().month(), b.time().currentDate().month());
+        EXPECT_EQ(a.time().currentDate().year(), b.time().currentDate().year());
+
+        EXPECT_EQ(a.resources().getMoney(), b.resources().getMoney());
+        EXPECT_EQ(a.resources().getMorale(), b.resources().getMorale());
+        EXPECT_EQ(a.resources().getSecurity(), b.resources().getSecurity());
+
+        for (const auto &tech : a.research().getAllTechnologies())
+        {
+            const Technology &other = b.research().getTechnology(tech.m_index);
+            EXPECT_EQ(tech.m_state, other.m_state) << tech.m_id;
+            EXPECT_EQ(tech.m_progressDays, other.m_progressDays) << tech.m_id;
+        }
+    }
+}
+
+TEST(EventHorizonSchedulerTests, StopsAtMonthBoundary)
+{
+    TimeDataModel time;
+    EventHorizonScheduler scheduler(time);
+
+    // 1.1.1939 -> 1.2.1939
+    EXPECT_EQ(scheduler.runUntilEvent(), 31);
+    EXPECT_EQ(time.currentDate().day(), 1);
+    EXPECT_EQ(time.currentDate().month(), 2);
+}
+
+TEST(EventHorizonSchedulerTests, StopsAtNearestHorizon)
+{
+    TimeDataModel time;
+    EventHorizonScheduler scheduler(time);
+    scheduler.addHorizon([](const TimeDataModel &) -> optional<unsigned short> { return 9; });
+    scheduler.addHorizon([](const TimeDataModel &) -> optional<unsigned short> { return std::nullopt; });
+
+    EXPECT_EQ(scheduler.runUntilEvent(), 9);
+    EXPECT_EQ(scheduler.runUntilEvent(5), 5);
+}
+
+TEST(EventHorizonSchedulerTests, MatchesDayByDayStepping)
+{
+    ResourceConstraints constraints;
+    constraints.initial_money = 150000;
+    auto techs = makeTechnologies();
+
+    SimulationWorld stepped(constraints, techs);
+    SimulationWorld jumped(constraints, techs);
+    prepare(stepped);
+    prepare(jumped);
+
+    while (stepped.time().currentGameDay() < MAX_GAME_DAY)
+    {
+        react(stepped);
+        stepped.time().nextDay();
+    }
+
+    unsigned jumps = 0;
+    while (jumped.time().currentGameDay() < MAX_GAME_DAY)
+    {
+        react(jumped);
+        jumped.scheduler().runUntilEvent();
+        jumps++;
+    }
+
+    EXPECT_LT(jumps, MAX_GAME_DAY / 4u);
+    EXPECT_LE(jumped.resources().getMoney(), 0);
+    EXPECT_EQ(jumped.resources().getMorale(), constraints.minimal_total_morale);
+    expectSameState(stepped, jumped);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "Core/header/Profiler.hpp"
+
+namespace fs = std::filesystem;
+
+TEST(ProfilerTests, AccumulatesSectionsPerFrame)
+{
+    FrameProfiler profiler;
+    const auto start = FrameProfiler::Clock::now();
+
+    profiler.beginFrame();
+    profiler.record("Draw", start, start + std::chrono::milliseconds(2));
+    profiler.record("Draw", start, start + std::chrono::milliseconds(3));
+    profiler.record("Tick", start, start + std::chrono::milliseconds(1));
+    // czas zmierzony na innym wątku dolicza się do tej samej sekcji
+    profiler.addSample("Tick", 0.5f);
+    profiler.endFrame();
+
+    ASSERT_EQ(profiler.sections().size(), 2u);
+    EXPECT_STREQ(profiler.sections()[0].m_name, "Draw");
+    EXPECT_NEAR(profiler.sections()[0].m_history[0], 5.f, 1e-3f);
+    EXPECT_NEAR(profiler.sections()[1].m_history[0], 1.5f, 1e-3f);
+    EXPECT_EQ(profiler.frameCount(), 1u);
+
+    // następna klatka zaczyna od zera
+    profiler.beginFrame();
+    profiler.endFrame();
+    EXPECT_EQ(profiler.sections()[0].m_history[1], 0.f);
+}
+
+TEST(ProfilerTests, ScopedTimerRecordsElapsedTime)
+{
+    FrameProfiler profiler;
+    profiler.beginFrame();
+    {
+        ScopedTimer timer(profiler, "Sleep");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    profiler.endFrame();
+
+    ASSERT_EQ(profiler.sections().size(), 1u);
+    EXPECT_GE(profiler.sections()[0].m_history[0], 2.f);
+    EXPECT_GE(profiler.frameHistory()[0], profiler.sections()[0].m_history[0]);
+}
+
+TEST(ProfilerTests, CapturesRequestedFramesToChromeTrace)
+{
+    FrameProfiler profiler;
+    profiler.startCapture(2);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        profiler.beginFrame();
+        {
+            ScopedTimer timer(profiler, "HUD \"quoted\"");
+        }
+        profiler.endFrame();
+    }
+
+    // 2 klatki x (sekcja + ramka); trzecia klatka już poza nagraniem
+    EXPECT_FALSE(profiler.isCapturing());
+    EXPECT_EQ(profiler.capturedEvents().size(), 4u);
+
+    const fs::path path = fs::temp_directory_path() / "manhattan_profiler_test.json";
+    ASSERT_TRUE(profiler.writeChromeTrace(path.string()));
+
+    std::stringstream content;
+    content << std::ifstream(path).rdbuf();
+    EXPECT_NE(content.str().find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(content.str().find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(content.str().find("HUD \\\"quoted\\\""), std::string::npos);
+    fs::remove(path);
+}
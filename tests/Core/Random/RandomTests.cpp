@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <random>
+
+#include "Core/header/Random.hpp"
+
+TEST(RandomTests, SameSeedGivesSameSequence)
+{
+    Xoshiro256 first(42);
+    Xoshiro256 second(42);
+    Xoshiro256 other(43);
+
+    bool differs = false;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto value = first();
+        EXPECT_EQ(value, second());
+        differs |= value != other();
+    }
+    EXPECT_TRUE(differs);
+
+    // działa z rozkładami z <random>
+    std::uniform_int_distribution<int> dice(1, 6);
+    for (int i = 0; i < 100; ++i)
+    {
+        const int roll = dice(first);
+        EXPECT_GE(roll, 1);
+        EXPECT_LE(roll, 6);
+    }
+}
+
+TEST(RandomTests, StateRoundTripContinuesSequence)
+{
+    Xoshiro256 original(0);
+    original();
+
+    Xoshiro256 restored;
+    ASSERT_TRUE(restored.setState(original.state()));
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(restored(), original());
+
+    // stan zerowy jest odrzucany
+    EXPECT_FALSE(restored.setState(Xoshiro256::State{}));
+    EXPECT_EQ(restored, original);
+}
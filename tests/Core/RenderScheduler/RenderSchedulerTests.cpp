@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "Core/header/RenderScheduler.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(RenderSchedulerTests, IdleAfterRequestedFramesAreDrawn)
+{
+    RenderScheduler scheduler(60);
+    const auto start = RenderScheduler::Clock::time_point{} + 1s;
+
+    // pierwsza klatka po starcie
+    ASSERT_TRUE(scheduler.shouldRender(start));
+    scheduler.beginFrame(start);
+
+    EXPECT_FALSE(scheduler.isRedrawPending());
+    EXPECT_FALSE(scheduler.shouldRender(start + 1s));
+    EXPECT_EQ(scheduler.waitTimeoutMs(start + 1s), RenderScheduler::IDLE_WAIT_MS);
+
+    // wejście: kilka klatek, potem znów bezczynność
+    scheduler.requestRedraw(RenderScheduler::INPUT_REDRAW_FRAMES);
+    auto now = start + 2s;
+    for (unsigned i = 0; i < RenderScheduler::INPUT_REDRAW_FRAMES; ++i)
+    {
+        ASSERT_TRUE(scheduler.shouldRender(now));
+        scheduler.beginFrame(now);
+        now += 20ms;
+    }
+    EXPECT_FALSE(scheduler.shouldRender(now));
+    EXPECT_EQ(scheduler.renderedFrames(), 1u + RenderScheduler::INPUT_REDRAW_FRAMES);
+}
+
+TEST(RenderSchedulerTests, FrameCapSpacesFrames)
+{
+    RenderScheduler scheduler(50); // 20 ms
+    const auto start = RenderScheduler::Clock::time_point{} + 1s;
+    scheduler.beginFrame(start);
+
+    scheduler.setAnimating(true);
+    EXPECT_FALSE(scheduler.shouldRender(start + 5ms));
+    EXPECT_EQ(scheduler.waitTimeoutMs(start + 5ms), 15);
+    EXPECT_EQ(scheduler.waitTimeoutMs(start + 5ms + 500us), 15);
+    EXPECT_TRUE(scheduler.shouldRender(start + 20ms));
+    EXPECT_EQ(scheduler.waitTimeoutMs(start + 20ms), 0);
+
+    // animacja trwa - rysowanie w każdym slocie, bez żądań
+    scheduler.beginFrame(start + 20ms);
+    EXPECT_TRUE(scheduler.shouldRender(start + 40ms));
+
+    scheduler.setAnimating(false);
+    EXPECT_FALSE(scheduler.shouldRender(start + 40ms));
+}
+
+TEST(RenderSchedulerTests, UncappedRendersImmediately)
+{
+    RenderScheduler scheduler(0);
+    const auto start = RenderScheduler::Clock::time_point{} + 1s;
+    scheduler.beginFrame(start);
+
+    scheduler.requestRedraw();
+    EXPECT_TRUE(scheduler.shouldRender(start));
+    EXPECT_EQ(scheduler.waitTimeoutMs(start), 0);
+
+    // żądania się nie sumują - liczy się największe
+    scheduler.requestRedraw(3);
+    scheduler.requestRedraw(1);
+    for (int i = 0; i < 3; ++i)
+        scheduler.beginFrame(start);
+    EXPECT_FALSE(scheduler.isRedrawPending());
+}
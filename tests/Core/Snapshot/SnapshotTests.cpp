@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "Core/header/Snapshot.hpp"
+#include "Core/header/TimeSystem.hpp"
+
+TEST(SnapshotTests, ReaderStopsAtEndOfData)
+{
+    SnapshotWriter writer;
+    writer.writeHeader();
+    writer.write(static_cast<std::uint32_t>(7));
+
+    auto bytes = writer.release();
+    SnapshotReader reader(span<const byte>(bytes).first(bytes.size() - 1));
+    ASSERT_TRUE(reader.readHeader());
+
+    std::uint32_t value = 42;
+    EXPECT_FALSE(reader.read(value));
+    EXPECT_EQ(value, 42u);
+}
+
+TEST(SnapshotTests, RejectsUnknownVersion)
+{
+    SnapshotWriter writer;
+    writer.write(SNAPSHOT_MAGIC);
+    writer.write(static_cast<std::uint16_t>(SNAPSHOT_VERSION + 1));
+
+    auto bytes = writer.release();
+    SnapshotReader reader(bytes);
+    EXPECT_FALSE(reader.readHeader());
+}
+
+TEST(SnapshotTests, TimeRoundTrip)
+{
+    TimeDataModel source;
+    source.advanceDays(400);
+
+    SnapshotWriter writer;
+    source.writeSnapshot(writer);
+    auto bytes = writer.release();
+
+    TimeDataModel restored;
+    SnapshotReader reader(bytes);
+    ASSERT_TRUE(restored.readSnapshot(reader));
+    EXPECT_TRUE(reader.atEnd());
+
+    EXPECT_EQ(restored.currentGameDay(), source.currentGameDay());
+    EXPECT_EQ(restored.currentDayOfWeek(), source.currentDayOfWeek());
+    EXPECT_EQ(restored.currentDate().day(), source.currentDate().day());
+    EXPECT_EQ(restored.currentDate().month(), source.currentDate().month());
+    EXPECT_EQ(restored.currentDate().year(), source.currentDate().year());
+}
+
+TEST(SnapshotTests, InvalidTimeLeavesModelUnchanged)
+{
+    SnapshotWriter writer;
+    writer.write(static_cast<unsigned short>(31));
+    writer.write(static_cast<unsigned short>(2)); // 31 lutego
+    writer.write(static_cast<unsigned short>(1940));
+    writer.write(static_cast<unsigned short>(400));
+    writer.write(static_cast<std::uint8_t>(0));
+    auto bytes = writer.release();
+
+    TimeDataModel model;
+    SnapshotReader reader(bytes);
+    EXPECT_FALSE(model.readSnapshot(reader));
+    EXPECT_EQ(model.currentGameDay(), MIN_GAME_DAY);
+}
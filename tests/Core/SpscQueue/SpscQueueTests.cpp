@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+
+#include "Core/header/SpscQueue.hpp"
+
+TEST(SpscQueueTests, FifoUntilFull)
+{
+    SpscQueue<int, 4> queue;
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 1; i <= 4; ++i)
+        ASSERT_TRUE(queue.tryPush(i));
+    EXPECT_FALSE(queue.tryPush(5));
+    EXPECT_EQ(queue.sizeApprox(), 4u);
+
+    ASSERT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 1);
+
+    // zwolnione miejsce - indeksy zawijają się po pojemności
+    ASSERT_TRUE(queue.tryPush(5));
+    for (int expected = 2; expected <= 5; ++expected)
+    {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(SpscQueueTests, ConcurrentTransferKeepsOrder)
+{
+    struct Item
+    {
+        std::uint64_t m_sequence = 0;
+        std::uint64_t m_check = 0;
+    };
+
+    SpscQueue<Item, 64> queue;
+    const std::uint64_t count = 200000;
+
+    std::thread producer([&]
+                         {
+        for (std::uint64_t i = 1; i <= count; ++i)
+        {
+            while (!queue.tryPush(Item{i, i * 2654435761u}))
+                std::this_thread::yield();
+        } });
+
+    // konsument: kolejne numery, bez zgubionych i rozdartych elementów
+    std::uint64_t expected = 1;
+    Item item;
+    while (expected <= count)
+    {
+        if (!queue.tryPop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(item.m_sequence, expected);
+        ASSERT_EQ(item.m_check, expected * 2654435761u);
+        expected++;
+    }
+
+    producer.join();
+    EXPECT_FALSE(queue.tryPop(item));
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "Core/header/Symbol.hpp"
+
+TEST(SymbolTests, SameNameGivesSameHandle)
+{
+    const Symbol a = "symbol_test_alpha";
+    const Symbol b = std::string("symbol_test_alpha");
+    const Symbol c = "symbol_test_beta";
+
+    EXPECT_TRUE(a.isValid());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.value(), b.value());
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.str(), "symbol_test_alpha");
+
+    // porównanie z napisem po treści
+    EXPECT_TRUE(a == "symbol_test_alpha");
+    EXPECT_TRUE(a == std::string("symbol_test_alpha"));
+    EXPECT_FALSE(c == "symbol_test_alpha");
+
+    std::ostringstream stream;
+    stream << c;
+    EXPECT_EQ(stream.str(), "symbol_test_beta");
+
+    std::unordered_set<Symbol> set{a, b, c};
+    EXPECT_EQ(set.size(), 2u);
+}
+
+TEST(SymbolTests, FindDoesNotIntern)
+{
+    const size_t before = SymbolTable::global().size();
+    EXPECT_FALSE(Symbol::find("symbol_test_never_interned").has_value());
+    EXPECT_EQ(SymbolTable::global().size(), before);
+
+    const Symbol interned = "symbol_test_found";
+    auto found = Symbol::find("symbol_test_found");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(*found, interned);
+
+    const Symbol invalid;
+    EXPECT_FALSE(invalid.isValid());
+    EXPECT_TRUE(invalid.str().empty());
+}
+
+TEST(SymbolTests, ConcurrentInterningAgrees)
+{
+    // dwa wątki internują te same napisy w przeciwnej kolejności
+    const unsigned count = 2000;
+    std::vector<Symbol> forward(count);
+    std::vector<Symbol> backward(count);
+    auto name = [](unsigned i) { return "symbol_test_concurrent_" + std::to_string(i); };
+
+    std::thread other([&]
+                      {
+        for (unsigned i = count; i-- > 0;)
+            backward[i] = name(i); });
+    for (unsigned i = 0; i < count; ++i)
+        forward[i] = name(i);
+    other.join();
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(forward[i], backward[i]);
+        ASSERT_EQ(forward[i].str(), name(i));
+    }
+}
+
+TEST(SymbolTests, ReadsWhileInterningAcrossChunks)
+{
+    // odczyt str() bez blokady, podczas gdy drugi wątek zakłada nowe kawałki tablicy
+    const Symbol stable = "symbol_test_stable_read";
+    const std::string &address = stable.str();
+    const unsigned count = static_cast<unsigned>(SymbolTable::CHUNK_SIZE) * 3;
+
+    std::thread writer([&]
+                       {
+        for (unsigned i = 0; i < count; ++i)
+            Symbol("symbol_test_chunk_" + std::to_string(i)); });
+
+    bool allMatch = true;
+    for (unsigned i = 0; i < count; ++i)
+        allMatch = allMatch && stable.str() == "symbol_test_stable_read";
+    writer.join();
+
+    EXPECT_TRUE(allMatch);
+    // referencja z name() nie zmienia się po dopisaniu kolejnych kawałków
+    EXPECT_EQ(&stable.str(), &address);
+    EXPECT_EQ(Symbol("symbol_test_chunk_0").str(), "symbol_test_chunk_0");
+    EXPECT_EQ(Symbol::find("symbol_test_chunk_" + std::to_string(count - 1))->str(),
+              "symbol_test_chunk_" + std::to_string(count - 1));
+}
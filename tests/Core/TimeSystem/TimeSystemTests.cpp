@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include "./../../../src/Core/header/TimeSystem.hpp"
 
 TEST(DateModelTests, LeapYearFebruary) {
@@ -101,3 +102,196 @@ TEST(TimeDataModelTests, MaxDateThrows) {
 
     EXPECT_THROW(t.nextDay(), std::range_error);
 }
+
+TEST(TimeDataModelTests, AdvanceDaysMatchesNextDay) {
+    TimeDataModel stepped;
+    TimeDataModel jumped;
+
+    for (int i = 0; i < 400; ++i)
+        stepped.nextDay();
+    jumped.advanceDays(400);
+
+    EXPECT_EQ(jumped.currentGameDay(), stepped.currentGameDay());
+    EXPECT_EQ(jumped.currentDayOfWeek(), stepped.currentDayOfWeek());
+    EXPECT_EQ(jumped.currentDate().day(), stepped.currentDate().day());
+    EXPECT_EQ(jumped.currentDate().month(), stepped.currentDate().month());
+    EXPECT_EQ(jumped.currentDate().year(), stepped.currentDate().year());
+}
+
+TEST(TimeDataModelTests, BatchedObserverCalledOncePerAdvance) {
+    TimeDataModel t;
+
+    int calls = 0;
+    unsigned short first = 0;
+    unsigned short count = 0;
+    int dailyCalls = 0;
+
+    auto batched = std::make_shared<TimeDataModel::DaysPassedCallback>(
+        [&](const TimeDataModel&, unsigned short a_first, unsigned short a_count){
+            calls++;
+            first = a_first;
+            count = a_count;
+        }
+    );
+    auto daily = std::make_shared<TimeDataModel::DayPassedCallback>(
+        [&](const TimeDataModel&){ dailyCalls++; }
+    );
+
+    t.addDaysObserver(batched);
+    t.addDayObserver(daily);
+    t.advanceDays(25);
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(first, MIN_GAME_DAY + 1);
+    EXPECT_EQ(count, 25);
+    EXPECT_EQ(dailyCalls, 25);
+
+    t.nextDay();
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(count, 1);
+}
+
+TEST(TimeDataModelTests, AdvanceDaysPastMaxThrowsWithoutChange) {
+    TimeDataModel t;
+    t.advanceDays(MAX_GAME_DAY - 10);
+
+    EXPECT_THROW(t.advanceDays(11), std::range_error);
+    EXPECT_EQ(t.currentGameDay(), MAX_GAME_DAY - 9);
+}
+
+TEST(TimeDataModelTests, SubscriptionsCalledInPriorityOrder) {
+    TimeDataModel t;
+    std::vector<int> order;
+
+    auto late = t.subscribeDays([&](const TimeDataModel&, unsigned short, unsigned short){ order.push_back(3); });
+    auto research = t.subscribeDays([&](const TimeDataModel&, unsigned short, unsigned short){ order.push_back(2); },
+                                    OBSERVER_PRIORITY_RESEARCH);
+    auto resources = t.subscribeDays([&](const TimeDataModel&, unsigned short, unsigned short){ order.push_back(1); },
+                                     OBSERVER_PRIORITY_RESOURCES);
+
+    t.advanceDays(3);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(TimeDataModelTests, SubscriptionEndsWithHandle) {
+    TimeDataModel t;
+    int calls = 0;
+
+    {
+        auto sub = t.subscribeDay([&](const TimeDataModel&){ calls++; });
+        t.nextDay();
+        EXPECT_TRUE(sub.isActive());
+    }
+    t.nextDay();
+    EXPECT_EQ(calls, 1);
+
+    auto sub = t.subscribeDay([&](const TimeDataModel&){ calls++; });
+    sub.reset();
+    EXPECT_FALSE(sub.isActive());
+    t.nextDay();
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(TimeDataModelTests, UnsubscribeInsideCallback) {
+    TimeDataModel t;
+    int selfCalls = 0;
+    int otherCalls = 0;
+
+    ObserverSubscription self;
+    ObserverSubscription other;
+    self = t.subscribeDay([&](const TimeDataModel&){ selfCalls++; self.reset(); other.reset(); });
+    other = t.subscribeDay([&](const TimeDataModel&){ otherCalls++; });
+
+    t.advanceDays(5);
+    EXPECT_EQ(selfCalls, 1);
+    EXPECT_EQ(otherCalls, 0);
+}
+
+TEST(TimeDataModelTests, SubscribeInsideCallbackStartsNextEvent) {
+    TimeDataModel t;
+    int added = 0;
+
+    ObserverSubscription late;
+    auto first = t.subscribeDay([&](const TimeDataModel&){
+        if (!late.isActive())
+            late = t.subscribeDay([&](const TimeDataModel&){ added++; });
+    });
+
+    t.nextDay();
+    EXPECT_EQ(added, 0);
+    t.nextDay();
+    EXPECT_EQ(added, 1);
+}
+
+TEST(TimeDataModelTests, ThrowingObserverLeavesRegistryUsable) {
+    TimeDataModel t;
+    int late = 0;
+    int after = 0;
+
+    ObserverSubscription lateSub;
+    auto thrower = t.subscribeDay([&](const TimeDataModel&){
+        lateSub = t.subscribeDay([&](const TimeDataModel&){ late++; });
+        throw std::runtime_error("observer failed");
+    });
+
+    EXPECT_THROW(t.nextDay(), std::runtime_error);
+    thrower.reset();
+
+    // dopisany w trakcie i dopisany po wyjątku dostają następne zdarzenia
+    auto afterSub = t.subscribeDay([&](const TimeDataModel&){ after++; });
+    t.nextDay();
+    EXPECT_EQ(late, 1);
+    EXPECT_EQ(after, 1);
+}
+
+TEST(TimeDataModelTests, HandleOutlivesModel) {
+    ObserverSubscription sub;
+    {
+        TimeDataModel t;
+        sub = t.subscribeDay([](const TimeDataModel&){});
+    }
+    EXPECT_FALSE(sub.isActive());
+    sub.reset();
+}
+
+TEST(CalendarTests, GregorianLeapRule) {
+    EXPECT_TRUE(isLeapYear(1944));
+    EXPECT_FALSE(isLeapYear(1942));
+    EXPECT_FALSE(isLeapYear(1900));
+    EXPECT_TRUE(isLeapYear(2000));
+    EXPECT_EQ(daysInMonthOf(2, 1944), 29);
+    EXPECT_EQ(daysInMonthOf(2, 1943), 28);
+}
+
+TEST(CalendarTests, RandomAccessMatchesStepping) {
+    TimeDataModel stepped;
+
+    for (unsigned short gameDay = MIN_GAME_DAY; gameDay < MAX_GAME_DAY; ++gameDay)
+    {
+        const DateModel date = TimeDataModel::dateOfGameDay(gameDay);
+        ASSERT_EQ(date.day(), stepped.currentDate().day());
+        ASSERT_EQ(date.month(), stepped.currentDate().month());
+        ASSERT_EQ(date.year(), stepped.currentDate().year());
+        ASSERT_EQ(TimeDataModel::dayOfWeekOfGameDay(gameDay), stepped.currentDayOfWeek());
+        ASSERT_EQ(TimeDataModel::gameDayOfDate(date), gameDay);
+        stepped.nextDay();
+    }
+}
+
+TEST(CalendarTests, GameDaysMapToRealWeekdays) {
+    TimeDataModel t;
+    EXPECT_EQ(t.currentDayOfWeek(), DayOfWeek::SUNDAY); // 1 stycznia 1939
+
+    const unsigned short pearlHarbor = TimeDataModel::gameDayOfDate(DateModel{7, 12, 1941});
+    t.advanceDays(pearlHarbor - t.currentGameDay());
+    EXPECT_EQ(t.currentDate().day(), 7);
+    EXPECT_EQ(t.currentDate().month(), 12);
+    EXPECT_EQ(t.currentDayOfWeek(), DayOfWeek::SUNDAY);
+}
+
+TEST(CalendarTests, GameDayOutOfRangeThrows) {
+    EXPECT_THROW(TimeDataModel::dateOfGameDay(0), std::range_error);
+    EXPECT_THROW(TimeDataModel::dateOfGameDay(MAX_GAME_DAY + 1), std::range_error);
+    EXPECT_THROW(TimeDataModel::gameDayOfDate(DateModel{31, 12, 1946}), std::range_error);
+    EXPECT_THROW(DateModel(31, 12, MAX_DATA_YEAR).nextDay(), std::range_error);
+}
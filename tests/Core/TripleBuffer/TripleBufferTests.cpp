@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include "Core/header/TripleBuffer.hpp"
+
+TEST(TripleBufferTests, ReaderSeesLatestPublication)
+{
+    TripleBuffer<int> buffer;
+    EXPECT_EQ(buffer.read(), 0);
+    EXPECT_FALSE(buffer.hasFresh());
+
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    buffer.writeBuffer() = 2;
+    buffer.publish();
+    EXPECT_TRUE(buffer.hasFresh());
+
+    // pośrednia publikacja przepada - czytelnik dostaje najnowszą
+    EXPECT_EQ(buffer.read(), 2);
+    EXPECT_FALSE(buffer.hasFresh());
+
+    // bez nowej publikacji ten sam bufor, nawet gdy pisarz pisze dalej
+    buffer.writeBuffer() = 3;
+    EXPECT_EQ(buffer.read(), 2);
+}
+
+TEST(TripleBufferTests, ConcurrentReaderNeverSeesTornOrOlderState)
+{
+    // cały bufor nosi ten sam numer - rozbieżność oznacza rozdarty odczyt
+    using Payload = std::array<unsigned long, 64>;
+    TripleBuffer<Payload> buffer;
+    const unsigned long publications = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]
+                       {
+        for (unsigned long i = 1; i <= publications; ++i)
+        {
+            buffer.writeBuffer().fill(i);
+            buffer.publish();
+        }
+        done = true; });
+
+    unsigned long last = 0;
+    bool consistent = true;
+    while (!done || buffer.hasFresh())
+    {
+        const Payload &payload = buffer.read();
+        for (unsigned long value : payload)
+            consistent &= value == payload[0];
+        consistent &= payload[0] >= last;
+        last = payload[0];
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(buffer.read()[0], publications);
+}
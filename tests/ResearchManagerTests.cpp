@@ -5,6 +5,7 @@
 #include "Research/ResearchManager.hpp"
 #include "Resources/ResourcesManager.hpp"
 #include "Core/header/TimeSystem.hpp"
+#include "TestTechnologies.hpp"
 
 using namespace std;
 
@@ -186,3 +187,339 @@ TEST_F(ResearchManagerTest, GetActiveResearchReturnsNullWhenIdle)
 {
     EXPECT_EQ(research.getActiveResearch(), nullptr);
 }
+
+TEST_F(ResearchManagerTest, AdvanceDaysCompletesResearchInOneJump)
+{
+    int completions = 0;
+    research.addResearchCompletedListener(
+        [&](const Technology &tech)
+        {
+            completions++;
+            // kolejne badanie startuje w dniu ukończenia i dostaje resztę paczki
+            if (tech.m_id == "basic_physics")
+                research.startResearch("uranium_enrichment");
+        });
+
+    research.startResearch("basic_physics");
+    timeModel.advanceDays(10);
+
+    EXPECT_EQ(completions, 2);
+    EXPECT_TRUE(research.isCompleted("basic_physics"));
+    EXPECT_TRUE(research.isCompleted("uranium_enrichment"));
+}
+
+TEST_F(ResearchManagerTest, CompilesIndexGraph)
+{
+    auto physics = research.findTechnology("basic_physics");
+    auto enrichment = research.findTechnology("uranium_enrichment");
+    ASSERT_TRUE(physics.has_value());
+    ASSERT_TRUE(enrichment.has_value());
+    EXPECT_FALSE(research.findTechnology("cold_fusion").has_value());
+
+    EXPECT_EQ(research.getTechnology(*physics).m_index, *physics);
+    ASSERT_EQ(research.getDependents(*physics).size(), 1u);
+    EXPECT_EQ(research.getDependents(*physics)[0], *enrichment);
+    ASSERT_EQ(research.getPrerequisites(*enrichment).size(), 1u);
+    EXPECT_EQ(research.getPrerequisites(*enrichment)[0], *physics);
+    EXPECT_TRUE(research.getPrerequisites(*physics).empty());
+}
+
+TEST_F(ResearchManagerTest, HandleQueriesMatchStringOverloads)
+{
+    const TechId physics = *research.findTechnology("basic_physics");
+    const Technology &tech = research.getTechnology(physics);
+
+    // id i wymagania są symbolami - lookup bez napisów
+    EXPECT_EQ(research.findTechnology(tech.m_id), physics);
+    EXPECT_EQ(research.findTechnology(Symbol("cold_fusion")), std::nullopt);
+    EXPECT_EQ(research.getTechnology(*research.findTechnology("uranium_enrichment")).m_prerequisites,
+              vector<Symbol>{tech.m_id});
+
+    EXPECT_TRUE(research.isAvailable(physics));
+    EXPECT_FALSE(research.isAvailable(INVALID_TECH_ID));
+    EXPECT_FALSE(research.isCompleted(INVALID_TECH_ID));
+    EXPECT_EQ(research.getProgress(INVALID_TECH_ID), 0.f);
+
+    ASSERT_TRUE(research.startResearch(physics));
+    timeModel.nextDay();
+    EXPECT_GT(research.getProgress(physics), 0.f);
+    EXPECT_EQ(research.getProgress(physics), research.getProgress("basic_physics"));
+    EXPECT_EQ(research.isCompleted(physics), research.isCompleted("basic_physics"));
+}
+
+TEST_F(ResearchManagerTest, UnknownPrerequisiteKeepsTechnologyLocked)
+{
+    Technology orphan;
+    orphan.m_id = "orphan";
+    orphan.m_name = "Orphan";
+    orphan.m_type = TechnologyType::Theory;
+    orphan.m_researchDays = 1;
+    orphan.m_prerequisites = {"basic_physics", "does_not_exist"};
+
+    vector<Technology> techs(research.getAllTechnologies());
+    techs.push_back(orphan);
+    research.loadTechnologies(techs);
+
+    research.startResearch("basic_physics");
+    timeModel.advanceDays(3);
+
+    EXPECT_TRUE(research.isCompleted("basic_physics"));
+    EXPECT_TRUE(research.isAvailable("uranium_enrichment"));
+    EXPECT_FALSE(research.isAvailable("orphan"));
+}
+
+TEST_F(ResearchManagerTest, DependentWaitsForAllPrerequisites)
+{
+    research.loadTechnologies({makeTech("a", 2), makeTech("b", 2), makeTech("ab", 2, {"a", "b"})});
+
+    research.startResearch("a");
+    timeModel.advanceDays(2);
+    EXPECT_TRUE(research.isCompleted("a"));
+    EXPECT_FALSE(research.isAvailable("ab"));
+
+    research.startResearch("b");
+    timeModel.advanceDays(2);
+    EXPECT_TRUE(research.isAvailable("ab"));
+}
+
+TEST_F(ResearchManagerTest, RunsResearchesConcurrentlyWithinPersonnelLimit)
+{
+    // 100 naukowców: a (60) i b (40) mieszczą się razem, c (10) już nie
+    research.loadTechnologies({makeTech("a", 2, {}, {.scientists = 60}), makeTech("b", 4, {}, {.scientists = 40}),
+                               makeTech("c", 1, {}, {.scientists = 10})});
+
+    EXPECT_TRUE(research.startResearch("a"));
+    EXPECT_TRUE(research.startResearch("b"));
+    EXPECT_FALSE(research.startResearch("c"));
+    EXPECT_EQ(research.getActiveResearches().size(), 2u);
+    EXPECT_EQ(research.getAssignedPersonnel()[roleIndex(PersonnelRole::Scientists)], 100u);
+    EXPECT_EQ(research.daysUntilNextCompletion(), 2);
+
+    timeModel.advanceDays(2);
+    EXPECT_TRUE(research.isCompleted("a"));
+    EXPECT_EQ(research.getActiveResearches().size(), 1u);
+    EXPECT_EQ(research.getAssignedPersonnel()[roleIndex(PersonnelRole::Scientists)], 40u);
+    EXPECT_TRUE(research.startResearch("c"));
+
+    timeModel.advanceDays(2);
+    EXPECT_TRUE(research.isCompleted("b"));
+    EXPECT_TRUE(research.isCompleted("c"));
+    EXPECT_TRUE(research.getActiveResearches().empty());
+}
+
+TEST_F(ResearchManagerTest, QueuedResearchStartsByPriorityWhenPersonnelFrees)
+{
+    // każde badanie zajmuje całą kadrę - reszta czeka w kolejce
+    const TechOptions allStaff{.scientists = 100};
+    research.loadTechnologies({makeTech("a", 2, {}, allStaff), makeTech("low", 1, {}, allStaff),
+                               makeTech("high", 1, {}, allStaff), makeTech("after_a", 1, {"a"}, allStaff)});
+
+    vector<string> completed;
+    research.addResearchCompletedListener(
+        [&](const Technology &tech) { completed.push_back(tech.m_id.str()); });
+
+    // kolejka startuje od razu, jeśli jest wolny personel
+    EXPECT_TRUE(research.queueResearch("a"));
+    ASSERT_NE(research.getActiveResearch(), nullptr);
+    EXPECT_EQ(research.getActiveResearch()->m_id, "a");
+
+    EXPECT_TRUE(research.queueResearch("after_a", 5));
+    EXPECT_TRUE(research.queueResearch("low", 1));
+    EXPECT_TRUE(research.queueResearch("high", 10));
+    ASSERT_EQ(research.getResearchQueue().size(), 3u);
+    EXPECT_EQ(research.getTechnology(research.getResearchQueue()[0].m_techId).m_id, "high");
+
+    timeModel.advanceDays(5);
+
+    // po ukończeniu a zwolniony personel bierze kolejne wpisy wg priorytetu
+    EXPECT_EQ(completed, (vector<string>{"a", "high", "after_a", "low"}));
+    EXPECT_TRUE(research.getResearchQueue().empty());
+}
+
+TEST_F(ResearchManagerTest, CachedLoadMatchesJson)
+{
+    const string cachePath = jsonPath.string() + ".bin";
+    fs::remove(cachePath);
+
+    // pierwszy start: JSON + zapis cache
+    ResearchManager first(timeModel, resources);
+    first.loadFromJsonCached(jsonPath.string());
+    ASSERT_TRUE(fs::exists(cachePath));
+
+    // drugi start: tylko z cache (JSON zastąpiony śmieciami, ale starszy niż cache)
+    const auto jsonTime = fs::last_write_time(jsonPath);
+    ofstream(jsonPath) << "not json";
+    fs::last_write_time(jsonPath, jsonTime);
+    fs::last_write_time(cachePath, jsonTime + std::chrono::seconds(1));
+
+    ResearchManager second(timeModel, resources);
+    second.loadFromJsonCached(jsonPath.string());
+
+    ASSERT_EQ(second.getAllTechnologies().size(), research.getAllTechnologies().size());
+    for (const auto &tech : research.getAllTechnologies())
+    {
+        const auto id = second.findTechnology(tech.m_id);
+        ASSERT_TRUE(id.has_value());
+        const Technology &cached = second.getTechnology(*id);
+        EXPECT_EQ(cached.m_name, tech.m_name);
+        EXPECT_EQ(cached.m_description, tech.m_description);
+        EXPECT_EQ(cached.m_prerequisites, tech.m_prerequisites);
+        EXPECT_EQ(cached.m_researchDays, tech.m_researchDays);
+        EXPECT_EQ(cached.m_moneyCost, tech.m_moneyCost);
+        EXPECT_EQ(cached.m_scientistsRequired, tech.m_scientistsRequired);
+        EXPECT_EQ(cached.m_state, tech.m_state);
+    }
+
+    fs::remove(cachePath);
+}
+
+TEST_F(ResearchManagerTest, StaleCacheFallsBackToJson)
+{
+    const string cachePath = jsonPath.string() + ".bin";
+    ofstream(cachePath, std::ios::binary) << "garbage";
+    fs::last_write_time(cachePath, fs::last_write_time(jsonPath) - std::chrono::seconds(10));
+
+    ResearchManager fresh(timeModel, resources);
+    fresh.loadFromJsonCached(jsonPath.string());
+
+    EXPECT_EQ(fresh.getAllTechnologies().size(), 2u);
+    // cache nadpisany danymi po parsowaniu JSON
+    EXPECT_GT(fs::file_size(cachePath), string("garbage").size());
+
+    fs::remove(cachePath);
+}
+
+TEST_F(ResearchManagerTest, DeterministicEstimateFollowsPrerequisites)
+{
+    const TechId uranium = *research.findTechnology("uranium_enrichment");
+
+    ResearchEstimate estimate = research.estimateCompletion(uranium);
+    ASSERT_TRUE(estimate.m_reachable);
+    EXPECT_DOUBLE_EQ(estimate.m_expectedDays, 8.0);
+    EXPECT_DOUBLE_EQ(estimate.m_variance, 0.0);
+
+    research.startResearch("basic_physics");
+    timeModel.nextDay();
+
+    estimate = research.estimateCompletion(uranium);
+    EXPECT_DOUBLE_EQ(estimate.m_expectedDays, 7.0);
+}
+
+TEST_F(ResearchManagerTest, RandomizedEstimateAccountsForRetries)
+{
+    Technology risky;
+    risky.m_id = "risky";
+    risky.m_name = "Risky";
+    risky.m_type = TechnologyType::Engineering;
+    risky.m_researchDays = 3;
+    risky.m_researchDaysMin = 2;
+    risky.m_researchDaysMax = 4;
+    risky.m_failureProbability = 0.5f;
+    risky.m_prerequisites = {"basic_physics"};
+
+    vector<Technology> techs(research.getAllTechnologies());
+    techs.push_back(risky);
+    research.loadTechnologies(techs);
+    research.setOutcomeMode(ResearchOutcomeMode::Randomized, 7);
+
+    // próba: E = 3, Var = (3^2 - 1) / 12; porażka 0.5 -> E = 3 / 0.5, Var = Var/q + p*E^2/q^2
+    const ResearchEstimate estimate = research.estimateCompletion(*research.findTechnology("risky"));
+    ASSERT_TRUE(estimate.m_reachable);
+    EXPECT_NEAR(estimate.m_expectedDays, 3.0 + 6.0, 1e-9);
+    EXPECT_NEAR(estimate.m_variance, (8.0 / 12.0) / 0.5 + 0.5 * 9.0 / 0.25, 1e-9);
+}
+
+TEST_F(ResearchManagerTest, FailedAttemptResetsProgress)
+{
+    Technology risky;
+    risky.m_id = "risky";
+    risky.m_name = "Risky";
+    risky.m_type = TechnologyType::Engineering;
+    risky.m_researchDays = 4;
+    risky.m_failureProbability = MAX_FAILURE_PROBABILITY;
+    research.loadTechnologies({risky});
+    research.setOutcomeMode(ResearchOutcomeMode::Randomized, 1);
+
+    int failures = 0;
+    research.addResearchFailedListener([&](const Technology &tech)
+    {
+        failures++;
+        EXPECT_TRUE(tech.isAvailable());
+        EXPECT_EQ(tech.m_progressDays, 0u);
+    });
+
+    ASSERT_TRUE(research.startResearch("risky"));
+    timeModel.advanceDays(4);
+
+    EXPECT_EQ(failures, 1);
+    EXPECT_TRUE(research.getActiveResearches().empty());
+    EXPECT_TRUE(research.isAvailable("risky"));
+}
+
+TEST_F(ResearchManagerTest, ProgressUsesSampledAttemptDays)
+{
+    Technology risky;
+    risky.m_id = "risky";
+    risky.m_name = "Risky";
+    risky.m_type = TechnologyType::Engineering;
+    risky.m_researchDays = 10;
+    risky.m_researchDaysMin = 2;
+    risky.m_researchDaysMax = 30;
+    research.setOutcomeMode(ResearchOutcomeMode::Randomized, 3);
+
+    // kilka losowań - czas próby zwykle różny od m_researchDays
+    for (int attempt = 0; attempt < 5; ++attempt)
+    {
+        research.loadTechnologies({risky});
+        ASSERT_TRUE(research.startResearch(0));
+        const ActiveResearch *slot = research.getActiveSlot(0);
+        ASSERT_NE(slot, nullptr);
+
+        const unsigned days = slot->m_researchDays;
+        if (days > 1)
+            timeModel.advanceDays(static_cast<unsigned short>(days - 1));
+        EXPECT_FLOAT_EQ(research.getProgress(0), float(days - 1) / float(days));
+        EXPECT_LT(research.getProgress(0), 1.0f);
+        timeModel = TimeDataModel();
+    }
+}
+
+TEST_F(ResearchManagerTest, RandomizedRunsAverageToEstimate)
+{
+    Technology risky;
+    risky.m_id = "risky";
+    risky.m_name = "Risky";
+    risky.m_type = TechnologyType::Engineering;
+    risky.m_researchDays = 10;
+    risky.m_researchDaysMin = 5;
+    risky.m_researchDaysMax = 15;
+    risky.m_failureProbability = 0.25f;
+    research.setOutcomeMode(ResearchOutcomeMode::Randomized, 42);
+
+    research.loadTechnologies({risky});
+    const double expected = research.estimateCompletion(0).m_expectedDays;
+
+    const int runs = 400;
+    unsigned long totalDays = 0;
+    for (int run = 0; run < runs; ++run)
+    {
+        // każda kampania od początku kalendarza (obserwatorzy zostają)
+        timeModel = TimeDataModel();
+        resources.addMoney(100000);
+        research.loadTechnologies({risky});
+        while (!research.isCompleted("risky"))
+        {
+            if (!research.getTechnology(0).isInProgress())
+            {
+                ASSERT_TRUE(research.startResearch(0));
+            }
+            const unsigned short step = *research.daysUntilNextCompletion();
+            ASSERT_GE(research.getActiveResearches().front().m_researchDays, 5u);
+            ASSERT_LE(research.getActiveResearches().front().m_researchDays, 15u);
+            timeModel.advanceDays(step);
+            totalDays += step;
+        }
+    }
+
+    EXPECT_NEAR(double(totalDays) / runs, expected, expected * 0.1);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "Research/ResearchScheduler.hpp"
+#include "Research/ResearchManager.hpp"
+#include "Resources/ResourcesManager.hpp"
+#include "Core/header/TimeSystem.hpp"
+#include "TestTechnologies.hpp"
+
+using namespace std;
+
+namespace
+{
+    const TechOptions STAFFED{.scientists = 10};
+}
+
+class ResearchSchedulerTest : public ::testing::Test
+{
+protected:
+    TimeDataModel timeModel;
+    ResourceConstraints constraints;
+    ResourcesManager resources;
+    ResearchManager research;
+    ResearchScheduler scheduler;
+
+    ResearchSchedulerTest()
+        : resources(constraints, timeModel),
+          research(timeModel, resources),
+          scheduler(timeModel, research, resources)
+    {
+        resources.addMoney(100000);
+        resources.setTotalScientists(100);
+        resources.hireScientists(100);
+
+        // a(3), b(5) -> ab(2) -> x(4)
+        research.loadTechnologies({makeTech("a", 3, {}, STAFFED), makeTech("b", 5, {}, STAFFED),
+                                   makeTech("ab", 2, {"a", "b"}, STAFFED), makeTech("x", 4, {"ab"}, STAFFED)});
+    }
+
+    TechId id(const string &techId) const { return *research.findTechnology(techId); }
+};
+
+/* -------------------------------------------------- */
+
+TEST_F(ResearchSchedulerTest, EarliestTimesFollowLongestPrerequisite)
+{
+    const unsigned today = timeModel.currentGameDay();
+
+    EXPECT_EQ(scheduler.timing(id("a")).m_earliestFinish, today + 3);
+    EXPECT_EQ(scheduler.timing(id("ab")).m_earliestStart, today + 5);
+    EXPECT_EQ(scheduler.timing(id("x")).m_earliestFinish, today + 11);
+
+    EXPECT_EQ(scheduler.criticalPath(id("x")), (vector<TechId>{id("b"), id("ab"), id("x")}));
+}
+
+TEST_F(ResearchSchedulerTest, RunningResearchDoesNotInvalidateCacheAsDaysPass)
+{
+    ASSERT_TRUE(research.startResearch("b"));
+    const unsigned finish = scheduler.timing(id("x")).m_earliestFinish;
+
+    timeModel.advanceDays(2);
+    EXPECT_EQ(scheduler.timing(id("x")).m_earliestFinish, finish);
+    EXPECT_EQ(scheduler.lastRecomputedCount(), 0u);
+}
+
+TEST_F(ResearchSchedulerTest, CompletionRecomputesOnlyAffectedSubgraph)
+{
+    scheduler.timing(id("x"));
+
+    ASSERT_TRUE(research.startResearch("a"));
+    scheduler.timing(id("x"));
+    // tylko a i jego potomkowie; niezależne b nie jest liczone
+    EXPECT_EQ(scheduler.lastRecomputedCount(), 3u);
+
+    timeModel.advanceDays(3);
+    ASSERT_TRUE(research.isCompleted("a"));
+    ASSERT_TRUE(research.startResearch("b"));
+    timeModel.advanceDays(1);
+
+    // wynik przyrostowy zgodny z pełnym przeliczeniem
+    ResearchScheduler fresh(timeModel, research, resources);
+    for (const auto &tech : research.getAllTechnologies())
+    {
+        EXPECT_EQ(scheduler.timing(tech.m_index).m_earliestStart, fresh.timing(tech.m_index).m_earliestStart) << tech.m_id;
+        EXPECT_EQ(scheduler.timing(tech.m_index).m_earliestFinish, fresh.timing(tech.m_index).m_earliestFinish) << tech.m_id;
+    }
+}
+
+TEST_F(ResearchSchedulerTest, ScheduleRespectsPersonnelAndSlots)
+{
+    const unsigned today = timeModel.currentGameDay();
+
+    SchedulerLimits parallel;
+    parallel.m_personnel[roleIndex(PersonnelRole::Scientists)] = 20;
+    EXPECT_EQ(scheduler.planSchedule(id("x"), parallel).m_finishDay, today + 11);
+
+    // jeden zespół: wszystko po kolei, b (dłuższy ogon) pierwsze
+    SchedulerLimits serial;
+    serial.m_personnel[roleIndex(PersonnelRole::Scientists)] = 10;
+    const ResearchSchedule schedule = scheduler.planSchedule(id("x"), serial);
+    EXPECT_TRUE(schedule.m_feasible);
+    EXPECT_EQ(schedule.m_finishDay, today + 14);
+    ASSERT_FALSE(schedule.m_entries.empty());
+    EXPECT_EQ(schedule.m_entries.front().m_techId, id("b"));
+
+    SchedulerLimits oneSlot = parallel;
+    oneSlot.m_maxConcurrentResearch = 1;
+    EXPECT_EQ(scheduler.planSchedule(id("x"), oneSlot).m_finishDay, today + 14);
+}
+
+TEST_F(ResearchSchedulerTest, ScheduleReportsImpossiblePlans)
+{
+    SchedulerLimits tooFew;
+    tooFew.m_personnel[roleIndex(PersonnelRole::Scientists)] = 5;
+    EXPECT_FALSE(scheduler.planSchedule(id("x"), tooFew).m_feasible);
+
+    research.loadTechnologies({makeTech("orphan", 1, {"missing"}, STAFFED)});
+    EXPECT_FALSE(scheduler.timing(0).m_reachable);
+    EXPECT_TRUE(scheduler.criticalPath(0).empty());
+    EXPECT_FALSE(scheduler.planSchedule(0).m_feasible);
+}
@@ -2,6 +2,7 @@
 
 #include "Resources/ResourcesManager.hpp"
 #include "Core/header/TimeSystem.hpp"
+#include "Core/header/Snapshot.hpp"
 
 class ResourcesManagerTest : public ::testing::Test
 {
@@ -129,3 +130,141 @@ TEST_F(ResourcesManagerTest, SecurityIsClampedToLimits)
     resources.reduceSecurity(1000);
     EXPECT_EQ(resources.getSecurity(), constraints.minimal_total_security);
 }
+
+/* ============================================================
+ *  advanceDays — POSTAĆ ZAMKNIĘTA == DZIEŃ PO DNIU
+ * ============================================================ */
+
+TEST_F(ResourcesManagerTest, AdvanceDaysMatchesDayByDay)
+{
+    TimeDataModel steppedTime;
+    ResourcesManager stepped(constraints, steppedTime);
+
+    // saldo przechodzi przez zero w trakcie paczki
+    for (auto *r : {&resources, &stepped})
+    {
+        r->hireScientists(100);
+        r->hireWorkers(300);
+        r->spendMoney(r->getMoney());
+        r->addMoney(4000);
+    }
+
+    for (int i = 0; i < 80; ++i)
+        steppedTime.nextDay();
+    time.advanceDays(80);
+
+    EXPECT_EQ(resources.getMoney(), stepped.getMoney());
+    EXPECT_EQ(resources.getMorale(), stepped.getMorale());
+    EXPECT_EQ(resources.getSecurity(), stepped.getSecurity());
+}
+
+/* ============================================================
+ *  PULA PERSONELU — GENERYCZNE API
+ * ============================================================ */
+
+TEST_F(ResourcesManagerTest, GenericApiMatchesPerRoleWrappers)
+{
+    EXPECT_TRUE(resources.hire(PersonnelRole::Engineers, 40));
+    EXPECT_TRUE(resources.hireScientists(10));
+
+    EXPECT_EQ(resources.getWorkingEngineers(), 40u);
+    EXPECT_EQ(resources.getWorking(PersonnelRole::Scientists), 10u);
+    EXPECT_EQ(resources.getAvailableToHire(PersonnelRole::Engineers),
+              resources.getTotalEngineers() - 40);
+
+    EXPECT_EQ(resources.dailyPersonnelCost(),
+              40ul * constraints.engineer_daily_cost + 10ul * constraints.scientist_daily_cost);
+    EXPECT_EQ(resources.thirtyDaysPersonnelCost(), resources.dailyPersonnelCost() * 30);
+
+    EXPECT_TRUE(resources.fire(PersonnelRole::Engineers, 15));
+    EXPECT_FALSE(resources.fire(PersonnelRole::Engineers, 1000));
+    EXPECT_EQ(resources.getWorkingEngineers(), 25u);
+}
+
+TEST_F(ResourcesManagerTest, SetTotalRespectsGlobalPersonnelLimit)
+{
+    const unsigned long others =
+        resources.getTotalWorkers() + resources.getTotalEngineers() + resources.getTotalArmyPersonnel();
+    const unsigned int fits = constraints.total_numbers_of_all_personnel - others;
+
+    EXPECT_TRUE(resources.setTotal(PersonnelRole::Scientists, fits));
+    EXPECT_FALSE(resources.setTotal(PersonnelRole::Scientists, fits + 1));
+    EXPECT_TRUE(resources.checkTotalNumbersOfAllPersonnel());
+}
+
+/* ============================================================
+ *  TRANSAKCJE — WSZYSTKO ALBO NIC
+ * ============================================================ */
+
+TEST_F(ResourcesManagerTest, TransactionCommitsAllChangesAtOnce)
+{
+    const long before = resources.getMoney();
+    ResourceTransaction transaction;
+    transaction.hire(PersonnelRole::Workers, 100)
+        .hire(PersonnelRole::Scientists, 10)
+        .fire(PersonnelRole::Scientists, 4);
+    transaction.m_uranium = 25;
+
+    ASSERT_TRUE(resources.applyTransaction(transaction));
+    EXPECT_EQ(resources.getWorkingWorkers(), 100u);
+    EXPECT_EQ(resources.getWorkingScientists(), 6u);
+    EXPECT_EQ(resources.getUranium(), 25u);
+    // koszt zatrudnienia od sumy netto roli
+    EXPECT_EQ(resources.getMoney(),
+              before - 100l * constraints.worker_hiring_cost - 6l * constraints.scientist_hiring_cost);
+}
+
+TEST_F(ResourcesManagerTest, RejectedTransactionLeavesStateUntouched)
+{
+    ASSERT_TRUE(resources.hireEngineers(20));
+    const long money = resources.getMoney();
+
+    ResourceTransaction transaction;
+    transaction.hire(PersonnelRole::Workers, 50)
+        .fire(PersonnelRole::Engineers, 30); // pracuje tylko 20
+    transaction.m_plutonium = -1;
+
+    ResourceMissing missing;
+    EXPECT_FALSE(resources.applyTransaction(transaction, &missing));
+    EXPECT_TRUE(missing.engineers);
+    EXPECT_TRUE(missing.plutonium);
+    EXPECT_FALSE(missing.workers);
+    EXPECT_FALSE(missing.money);
+
+    EXPECT_EQ(resources.getWorkingWorkers(), 0u);
+    EXPECT_EQ(resources.getWorkingEngineers(), 20u);
+    EXPECT_EQ(resources.getMoney(), money);
+
+    // saldo sprawdzane łącznie z kosztem zatrudnienia
+    ResourceTransaction tooExpensive;
+    tooExpensive.hire(PersonnelRole::Workers, 10);
+    tooExpensive.m_money = -money;
+    EXPECT_TRUE(resources.validateTransaction(tooExpensive).money);
+    EXPECT_FALSE(resources.applyTransaction(tooExpensive));
+    EXPECT_EQ(resources.getMoney(), money);
+}
+
+TEST(ResourceConstraintsTest, BinaryCacheRoundTrip)
+{
+    ResourceConstraints source;
+    source.initial_money = 12345;
+    source.scientist_daily_cost = 9;
+    source.maximum_total_engineers = 777;
+
+    SnapshotWriter writer;
+    source.writeBinary(writer);
+    auto bytes = writer.release();
+
+    ResourceConstraints loaded;
+    SnapshotReader reader(bytes);
+    ASSERT_TRUE(loaded.readBinary(reader));
+    EXPECT_EQ(loaded.initial_money, 12345u);
+    EXPECT_EQ(loaded.scientist_daily_cost, 9);
+    EXPECT_EQ(loaded.maximum_total_engineers, 777u);
+
+    // ucięty blob jest odrzucany bez zmiany danych
+    ResourceConstraints untouched;
+    SnapshotReader truncated(span<const byte>(bytes).first(bytes.size() - 1));
+    EXPECT_FALSE(untouched.readBinary(truncated));
+    EXPECT_EQ(untouched.initial_money, ResourceConstraints{}.initial_money);
+}
@@ -0,0 +1,487 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <thread>
+#include <tuple>
+
+#include "Simulation/WorkStealingPool.hpp"
+#include "Simulation/MonteCarloSweep.hpp"
+#include "Simulation/SimulationWorld.hpp"
+#include "Simulation/CampaignScript.hpp"
+#include "Simulation/CommandDispatcher.hpp"
+#include "Simulation/Replay.hpp"
+#include "Simulation/SimulationStateView.hpp"
+#include "Simulation/CommandQueue.hpp"
+#include "Simulation/SimulationThread.hpp"
+#include "TestTechnologies.hpp"
+
+namespace
+{
+    const TechOptions CAMPAIGN_TECH{.scientists = 5, .moneyCost = 100};
+
+    vector<Technology> makeTechnologies()
+    {
+        return {makeTech("a", 40, {}, CAMPAIGN_TECH), makeTech("b", 60, {"a"}, CAMPAIGN_TECH),
+                makeTech("c", 30, {"a"}, CAMPAIGN_TECH), makeTech("d", 90, {"b", "c"}, CAMPAIGN_TECH),
+                makeTech("e", 20, {}, CAMPAIGN_TECH)};
+    }
+
+    // Czeka (z limitem) na warunek spełniany przez wątek symulacji.
+    template <typename Predicate>
+    bool waitUntil(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::seconds(10))
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST(WorkStealingPoolTests, RunsEverySubmittedTask)
+{
+    std::atomic<int> counter{0};
+    WorkStealingPool pool(4);
+
+    for (int i = 0; i < 1000; ++i)
+        pool.submit([&] { counter++; });
+
+    pool.wait();
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(SimulationWorldTests, SameSeedGivesSameCampaign)
+{
+    ResourceConstraints constraints;
+    auto techs = makeTechnologies();
+
+    SimulationWorld first(constraints, techs, 42);
+    SimulationWorld second(constraints, techs, 42);
+
+    CampaignResult a = runScriptedCampaign(first);
+    CampaignResult b = runScriptedCampaign(second);
+
+    EXPECT_EQ(a.daysSimulated, b.daysSimulated);
+    EXPECT_EQ(a.lastCompletionDay, b.lastCompletionDay);
+    EXPECT_EQ(a.completedTechnologies, techs.size());
+    EXPECT_EQ(a.finalMoney, b.finalMoney);
+}
+
+TEST(MonteCarloSweepTests, ResultDoesNotDependOnThreadCount)
+{
+    ResourceConstraints constraints;
+    auto techs = makeTechnologies();
+
+    SweepConfig config;
+    config.campaigns = 50;
+    config.campaignsPerTask = 7;
+    config.seed = 123;
+
+    config.threads = 1;
+    SweepResult single = runMonteCarloSweep(constraints, techs, config);
+    config.threads = 4;
+    SweepResult parallel = runMonteCarloSweep(constraints, techs, config);
+
+    EXPECT_EQ(single.campaigns, 50u);
+    EXPECT_EQ(parallel.campaigns, 50u);
+    EXPECT_EQ(single.allResearchCompleted, parallel.allResearchCompleted);
+    EXPECT_EQ(single.moraleGameOvers, parallel.moraleGameOvers);
+    EXPECT_EQ(single.finalCompletionDay.m_counts, parallel.finalCompletionDay.m_counts);
+    EXPECT_EQ(single.finalMoney.m_counts, parallel.finalMoney.m_counts);
+}
+
+TEST(MonteCarloSweepTests, RandomizedOutcomesDependOnCampaignSeed)
+{
+    ResourceConstraints constraints;
+    // jedna technologia - kolejność badań nie zależy od generatora świata
+    Technology tech = makeTech("a", 50, {}, CAMPAIGN_TECH);
+    tech.m_researchDaysMin = 20;
+    tech.m_researchDaysMax = 80;
+    tech.m_failureProbability = 0.3f;
+    const vector<Technology> techs{tech};
+
+    std::set<unsigned short> deterministicDays;
+    std::set<unsigned short> randomizedDays;
+    for (unsigned long long seed = 0; seed < 16; ++seed)
+    {
+        SimulationWorld deterministic(constraints, techs, seed);
+        SimulationWorld randomized(constraints, techs, seed, ResearchOutcomeMode::Randomized);
+        EXPECT_EQ(randomized.research().getOutcomeMode(), ResearchOutcomeMode::Randomized);
+
+        deterministicDays.insert(runScriptedCampaign(deterministic).lastCompletionDay);
+        randomizedDays.insert(runScriptedCampaign(randomized).lastCompletionDay);
+    }
+    EXPECT_EQ(deterministicDays.size(), 1u);
+    EXPECT_GT(randomizedDays.size(), 1u);
+
+    // ten sam tryb przechodzi przez SweepConfig
+    SweepConfig config;
+    config.campaigns = 64;
+    config.threads = 2;
+    config.outcomeMode = ResearchOutcomeMode::Randomized;
+    SweepResult result = runMonteCarloSweep(constraints, techs, config);
+    const auto usedBins = std::count_if(result.finalCompletionDay.m_counts.begin(),
+                                        result.finalCompletionDay.m_counts.end(),
+                                        [](unsigned long count) { return count > 0; });
+    EXPECT_GT(usedBins, 1);
+}
+
+TEST(SimulationWorldTests, SnapshotRestoresCampaignMidway)
+{
+    ResourceConstraints constraints;
+    auto techs = makeTechnologies();
+
+    SimulationWorld original(constraints, techs, 7);
+    original.resources().hireScientists(20);
+    original.research().startResearch("a");
+    original.research().queueResearch("e", 1);
+    original.time().advanceDays(55);
+
+    auto snapshot = original.saveSnapshot();
+
+    SimulationWorld restored(constraints, techs);
+    ASSERT_TRUE(restored.loadSnapshot(snapshot));
+    EXPECT_EQ(restored.saveSnapshot(), snapshot);
+
+    CampaignResult a = runScriptedCampaign(original);
+    CampaignResult b = runScriptedCampaign(restored);
+    EXPECT_EQ(a.lastCompletionDay, b.lastCompletionDay);
+    EXPECT_EQ(a.finalMoney, b.finalMoney);
+    EXPECT_EQ(a.completedTechnologies, b.completedTechnologies);
+}
+
+TEST(SimulationWorldTests, AdvanceDaysMatchesDayByDayAcrossCompletion)
+{
+    ResourceConstraints constraints;
+    vector<Technology> techs = {makeTech("a", 4, {}, CAMPAIGN_TECH), makeTech("c", 30, {"a"}, CAMPAIGN_TECH),
+                                makeTech("e", 20, {}, CAMPAIGN_TECH)};
+    techs[0].m_daylyCost = 50;
+    techs[1].m_daylyCost = 70;
+    techs[2].m_daylyCost = 30;
+
+    // ukończenie "a" w środku paczki: kolejka startuje "e", listener startuje "c"
+    auto run = [&](bool batched)
+    {
+        auto world = std::make_unique<SimulationWorld>(constraints, techs);
+        unsigned short completionDay = 0;
+        world->research().addResearchCompletedListener([&](const Technology &tech)
+                                                       {
+            if (tech.m_id == "a")
+            {
+                completionDay = world->time().currentGameDay();
+                world->research().startResearch("c");
+            } });
+        world->resources().hireScientists(10);
+        world->research().startResearch("a");
+        world->research().queueResearch("e");
+
+        if (batched)
+            world->time().advanceDays(10);
+        else
+            for (int i = 0; i < 10; ++i)
+                world->time().nextDay();
+
+        return std::make_tuple(completionDay, world->resources().getMoney(), world->resources().getMorale(),
+                               world->research().getTechnology(1).m_progressDays,
+                               world->research().getTechnology(2).m_progressDays);
+    };
+
+    const auto batched = run(true);
+    const auto stepped = run(false);
+    EXPECT_EQ(std::get<0>(batched), MIN_GAME_DAY + 4);
+    EXPECT_EQ(batched, stepped);
+}
+
+TEST(SimulationWorldTests, ForkedWorldIsIndependent)
+{
+    ResourceConstraints constraints;
+    SimulationWorld world(constraints, makeTechnologies(), 3);
+    world.resources().hireScientists(5);
+    world.research().startResearch("a");
+
+    auto whatIf = world.fork();
+    ASSERT_NE(whatIf, nullptr);
+    whatIf->time().advanceDays(40);
+
+    EXPECT_TRUE(whatIf->research().getTechnology(*whatIf->research().findTechnology("a")).isCompleted());
+    EXPECT_FALSE(world.research().getTechnology(*world.research().findTechnology("a")).isCompleted());
+    EXPECT_EQ(world.time().currentGameDay(), MIN_GAME_DAY);
+}
+
+TEST(SimulationWorldTests, SnapshotKeepsLoadedStaticData)
+{
+    ResourceConstraints constraints;
+    SimulationWorld world(constraints, makeTechnologies(), 11);
+    world.resources().hireScientists(5);
+    world.research().startResearch("a");
+    world.time().advanceDays(10);
+    const auto snapshot = world.saveSnapshot();
+
+    // stan dynamiczny i generatory w postaci binarnej - bez ~6 KB tekstu na mt19937_64
+    EXPECT_LT(snapshot.size(), 1024u);
+
+    // te same id, inne czasy badań: snapshot nie nadpisuje danych statycznych
+    auto retuned = makeTechnologies();
+    retuned[0].m_researchDays = 15;
+    SimulationWorld restored(constraints, retuned);
+    ASSERT_TRUE(restored.loadSnapshot(snapshot));
+    const TechId a = *restored.research().findTechnology("a");
+    EXPECT_EQ(restored.research().getTechnology(a).m_researchDays, 15u);
+    EXPECT_EQ(restored.research().getActiveSlot(a)->m_researchDays, 40u);
+    EXPECT_EQ(restored.rng(), world.rng());
+}
+
+TEST(SimulationWorldTests, SnapshotOfOtherTechnologiesIsRejected)
+{
+    ResourceConstraints constraints;
+    SimulationWorld world(constraints, makeTechnologies());
+    SimulationWorld other(constraints, vector<Technology>{makeTech("x", 5, {}, CAMPAIGN_TECH)});
+
+    EXPECT_FALSE(other.loadSnapshot(world.saveSnapshot()));
+}
+
+namespace
+{
+    // Krótka sesja "gracza" nagrana do logu.
+    void recordSession(SimulationWorld &world, CommandLog &log)
+    {
+        log.begin(ResourceConstraints{}, world.time(), world.resources(), world.research());
+
+        CommandDispatcher commands(world.time(), world.resources(), world.research());
+        commands.setLog(&log);
+
+        commands.hire(PersonnelRole::Scientists, 10);
+        commands.startResearch(*world.research().findTechnology("a"));
+        commands.queueResearch(*world.research().findTechnology("e"), 2);
+        commands.advanceDays(30);
+        commands.addMoney(5000);
+
+        ResourceTransaction staffing;
+        staffing.hire(PersonnelRole::Engineers, 5).hire(PersonnelRole::Scientists, 2);
+        staffing.m_money = -100;
+        commands.applyTransaction(staffing);
+        // odrzucona w całości - również w powtórce
+        ResourceTransaction rejected;
+        rejected.hire(PersonnelRole::Workers, 1).fire(PersonnelRole::ArmyPersonnel, 1);
+        commands.applyTransaction(rejected);
+        commands.checkpoint();
+        commands.advanceDays(45);
+        commands.fire(PersonnelRole::Scientists, 3);
+        commands.startResearch(*world.research().findTechnology("c"));
+        commands.advanceDays(100);
+        commands.checkpoint();
+    }
+}
+
+TEST(CommandLogTests, ReplayReproducesRecordedSession)
+{
+    auto techs = makeTechnologies();
+    SimulationWorld world(ResourceConstraints{}, techs);
+    CommandLog log;
+    recordSession(world, log);
+
+    CommandLog loaded;
+    ASSERT_TRUE(loaded.loadFromBytes(log.toBytes()));
+    ASSERT_EQ(loaded.commands().size(), log.commands().size());
+
+    ReplayResult result = replayCommandLog(loaded, techs);
+    EXPECT_FALSE(result.desynced) << result.error;
+    EXPECT_EQ(result.commandsExecuted, log.commands().size());
+    EXPECT_EQ(result.checkpointsVerified, 2u);
+    EXPECT_EQ(result.finalHash, computeStateHash(world.time(), world.resources(), world.research()));
+}
+
+TEST(CommandLogTests, ReplayDetectsDivergentData)
+{
+    auto techs = makeTechnologies();
+    SimulationWorld world(ResourceConstraints{}, techs);
+    CommandLog log;
+    recordSession(world, log);
+
+    // ta sama lista id, inny koszt badania -> inne saldo w checkpoincie
+    techs[0].m_moneyCost += 50;
+    ReplayResult result = replayCommandLog(log, techs);
+    EXPECT_TRUE(result.desynced);
+    EXPECT_EQ(result.checkpointsVerified, 0u);
+}
+
+TEST(CommandLogTests, TruncatedRecordIsIgnored)
+{
+    auto techs = makeTechnologies();
+    SimulationWorld world(ResourceConstraints{}, techs);
+    CommandLog log;
+    recordSession(world, log);
+
+    auto bytes = log.toBytes();
+    bytes.resize(bytes.size() - 3);
+
+    CommandLog loaded;
+    ASSERT_TRUE(loaded.loadFromBytes(bytes));
+    EXPECT_EQ(loaded.commands().size(), log.commands().size() - 1);
+}
+
+TEST(StateViewPublisherTests, ViewStaysStableUntilNextAcquire)
+{
+    SimulationWorld world(ResourceConstraints{}, makeTechnologies());
+    StateViewPublisher publisher(world.time(), world.resources(), world.research());
+
+    ASSERT_TRUE(world.resources().hireScientists(10));
+    ASSERT_TRUE(world.research().startResearch("a"));
+    publisher.publish();
+
+    const SimulationStateView &view = publisher.acquire();
+    const TechId a = *world.research().findTechnology("a");
+    EXPECT_EQ(view.m_version, 1u);
+    EXPECT_EQ(view.m_gameDay, world.time().currentGameDay());
+    EXPECT_EQ(view.m_money, world.resources().getMoney());
+    EXPECT_EQ(view.m_workingPersonnel[roleIndex(PersonnelRole::Scientists)], 10u);
+    ASSERT_EQ(view.m_techs.size(), world.research().getAllTechnologies().size());
+    EXPECT_TRUE(view.m_techs[a].isInProgress());
+    EXPECT_EQ(view.m_forecast.size(), StateViewPublisher::FORECAST_DAYS);
+    const std::uint64_t researchVersion = view.m_researchVersion;
+
+    // symulacja idzie dalej - trzymany widok się nie zmienia
+    world.time().advanceDays(40);
+    publisher.publish();
+    EXPECT_EQ(view.m_version, 1u);
+    EXPECT_TRUE(view.m_techs[a].isInProgress());
+
+    const SimulationStateView &next = publisher.acquire();
+    EXPECT_EQ(next.m_version, 2u);
+    EXPECT_EQ(next.m_gameDay, world.time().currentGameDay());
+    EXPECT_TRUE(next.m_techs[a].isCompleted());
+    EXPECT_GT(next.m_researchVersion, researchVersion);
+}
+
+TEST(StateViewPublisherTests, PublishesOnlyWhenStateChanged)
+{
+    SimulationWorld world(ResourceConstraints{}, makeTechnologies());
+    StateViewPublisher publisher(world.time(), world.resources(), world.research());
+
+    EXPECT_TRUE(publisher.publishIfChanged());
+    publisher.acquire();
+    EXPECT_FALSE(publisher.publishIfChanged());
+    EXPECT_FALSE(publisher.hasFresh());
+
+    // zmiana zasobów, dnia i stanu badań - każda daje nowy widok
+    world.resources().addMoney(100);
+    EXPECT_TRUE(publisher.publishIfChanged());
+    EXPECT_TRUE(publisher.hasFresh());
+    EXPECT_EQ(publisher.acquire().m_money, world.resources().getMoney());
+
+    world.time().nextDay();
+    EXPECT_TRUE(publisher.publishIfChanged());
+
+    ASSERT_TRUE(world.resources().hireScientists(10));
+    publisher.publishIfChanged();
+    ASSERT_TRUE(world.research().startResearch("a"));
+    EXPECT_TRUE(publisher.publishIfChanged());
+    EXPECT_FALSE(publisher.publishIfChanged());
+    EXPECT_EQ(publisher.publishedVersion(), 5u);
+
+    // ponowne dodanie z innym priorytetem nie zmienia długości kolejki
+    ASSERT_TRUE(world.research().queueResearch("b"));
+    EXPECT_TRUE(publisher.publishIfChanged());
+    ASSERT_TRUE(world.research().queueResearch("b", 5));
+    EXPECT_TRUE(publisher.publishIfChanged());
+    const SimulationStateView &view = publisher.acquire();
+    ASSERT_EQ(view.m_researchQueue.size(), 1u);
+    EXPECT_EQ(view.m_researchQueue[0].m_priority, 5);
+}
+
+TEST(SimulationThreadTests, CommandQueueDrainsInOrderThroughDispatcher)
+{
+    SimulationWorld world(ResourceConstraints{}, makeTechnologies());
+    CommandDispatcher dispatcher(world.time(), world.resources(), world.research());
+    CommandQueue queue;
+    const TechId a = *world.research().findTechnology("a");
+    const long money = world.resources().getMoney();
+
+    EXPECT_TRUE(queue.addMoney(500));
+    EXPECT_TRUE(queue.hire(PersonnelRole::Scientists, 10));
+    EXPECT_TRUE(queue.startResearch(a));
+    EXPECT_TRUE(queue.advanceDays(3));
+
+    // nic się nie dzieje do drain (wątek symulacji)
+    EXPECT_EQ(world.resources().getMoney(), money);
+    EXPECT_EQ(queue.drain(dispatcher), 4u);
+    EXPECT_TRUE(world.research().getTechnology(a).isInProgress());
+    EXPECT_EQ(world.time().currentGameDay(), MIN_GAME_DAY + 3);
+
+    // pełna kolejka odrzuca zamiast blokować UI
+    for (size_t i = 0; i < CommandQueue::CAPACITY; ++i)
+        ASSERT_TRUE(queue.addMoney(1));
+    EXPECT_FALSE(queue.addMoney(1));
+    EXPECT_EQ(queue.drain(dispatcher), CommandQueue::CAPACITY);
+}
+
+TEST(SimulationThreadTests, AppliesCommandsWhilePausedAndRunsAtMaxSpeed)
+{
+    SimulationWorld world(ResourceConstraints{}, makeTechnologies());
+    CommandDispatcher dispatcher(world.time(), world.resources(), world.research());
+    StateViewPublisher publisher(world.time(), world.resources(), world.research());
+    publisher.publish();
+    publisher.acquire();
+
+    CommandQueue queue;
+    SimulationThread simulation(world.time(), world.research(), dispatcher, queue, publisher);
+    std::atomic<int> published{0};
+    simulation.setPublishedCallback([&] { published++; });
+    simulation.start();
+
+    // pauza: komendy się wykonują, czas stoi
+    const TechId a = *world.research().findTechnology("a");
+    ASSERT_TRUE(queue.hire(PersonnelRole::Scientists, 10));
+    ASSERT_TRUE(queue.startResearch(a));
+    ASSERT_TRUE(waitUntil([&] { return publisher.acquire().m_techs[a].isInProgress(); }));
+    EXPECT_GT(published.load(), 0);
+    EXPECT_EQ(publisher.acquire().m_gameDay, MIN_GAME_DAY);
+    EXPECT_EQ(simulation.speed(), GameSpeed::Paused);
+
+    simulation.setSpeed(GameSpeed::Max);
+    ASSERT_TRUE(waitUntil([&] { return publisher.acquire().m_gameDay > MIN_GAME_DAY + 100; }));
+    // czas kroku symulacji jedzie w widoku do profilera UI
+    EXPECT_GT(publisher.acquire().m_tickMs, 0.f);
+    simulation.setSpeed(GameSpeed::Paused);
+    simulation.stop();
+
+    // po stop() świat znów należy do tego wątku
+    EXPECT_TRUE(world.research().getTechnology(a).isCompleted());
+    SimulationEvent event;
+    bool completed = false;
+    while (simulation.pollEvent(event))
+        completed |= event.m_type == SimulationEventType::ResearchCompleted && event.m_techId == a;
+    EXPECT_TRUE(completed);
+}
+
+TEST(SimulationThreadTests, CampaignEndPausesTheGame)
+{
+    SimulationWorld world(ResourceConstraints{}, makeTechnologies());
+    CommandDispatcher dispatcher(world.time(), world.resources(), world.research());
+    StateViewPublisher publisher(world.time(), world.resources(), world.research());
+    CommandQueue queue;
+    SimulationThread simulation(world.time(), world.research(), dispatcher, queue, publisher);
+    CommandLog log;
+    log.begin(ResourceConstraints{}, world.time(), world.resources(), world.research());
+    dispatcher.setLog(&log);
+
+    simulation.start();
+    simulation.setSpeed(GameSpeed::Max);
+    ASSERT_TRUE(waitUntil([&] { return simulation.speed() == GameSpeed::Paused; }, std::chrono::seconds(60)));
+    simulation.stop();
+
+    EXPECT_EQ(world.time().currentGameDay(), MAX_GAME_DAY);
+    // dni idą partiami - w logu dużo mniej rekordów niż dni kampanii
+    EXPECT_LT(log.commands().size(), static_cast<size_t>(MAX_GAME_DAY - MIN_GAME_DAY) / 4);
+
+    // log partii odtwarza tę samą kampanię
+    ReplayResult result = replayCommandLog(log, makeTechnologies());
+    EXPECT_FALSE(result.desynced) << result.error;
+    EXPECT_EQ(result.finalHash, computeStateHash(world.time(), world.resources(), world.research()));
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "Research/TechTreeLayout.hpp"
+#include "Research/ResearchManager.hpp"
+#include "Resources/ResourcesManager.hpp"
+#include "Core/header/TimeSystem.hpp"
+#include "TestTechnologies.hpp"
+
+using namespace std;
+
+namespace
+{
+    // Kolejne "diamenty": każdy poziom to dwie technologie wymagające obu z poprzedniego.
+    // Stare drzewo z TreeNode rysowało ostatni poziom 2^depth razy.
+    vector<Technology> makeDiamondChain(unsigned depth)
+    {
+        vector<Technology> techs{makeTech("l0_a", 5, {}), makeTech("l0_b", 5, {})};
+        for (unsigned level = 1; level <= depth; ++level)
+        {
+            const string prev = "l" + to_string(level - 1);
+            const string cur = "l" + to_string(level);
+            techs.push_back(makeTech(cur + "_a", 5, {prev + "_a", prev + "_b"}));
+            techs.push_back(makeTech(cur + "_b", 5, {prev + "_a", prev + "_b"}));
+        }
+        return techs;
+    }
+}
+
+class TechTreeLayoutTest : public ::testing::Test
+{
+protected:
+    TimeDataModel timeModel;
+    ResourceConstraints constraints;
+    ResourcesManager resources;
+    ResearchManager research;
+    TechTreeLayout layout;
+
+    TechTreeLayoutTest()
+        : resources(constraints, timeModel),
+          research(timeModel, resources)
+    {
+    }
+
+    TechId id(const string &techId) const { return *research.findTechnology(techId); }
+};
+
+/* -------------------------------------------------- */
+
+TEST_F(TechTreeLayoutTest, LayersFollowLongestPrerequisitePath)
+{
+    research.loadTechnologies({
+        makeTech("root", 5, {}),
+        makeTech("left", 5, {"root"}),
+        makeTech("right", 5, {"root"}),
+        makeTech("join", 5, {"left", "right"}),
+        makeTech("late", 5, {"join", "root"}),
+    });
+    layout.build(research);
+
+    ASSERT_EQ(layout.nodes().size(), 5u);
+    EXPECT_EQ(layout.layerCount(), 4u);
+    EXPECT_EQ(layout.nodes()[id("root")].m_layer, 0u);
+    EXPECT_EQ(layout.nodes()[id("left")].m_layer, 1u);
+    EXPECT_EQ(layout.nodes()[id("right")].m_layer, 1u);
+    EXPECT_EQ(layout.nodes()[id("join")].m_layer, 2u);
+    EXPECT_EQ(layout.nodes()[id("late")].m_layer, 3u);
+    EXPECT_EQ(layout.edges().size(), 6u);
+
+    // wymagania zawsze na lewo, węzły się nie nakładają
+    for (const auto &edge : layout.edges())
+        EXPECT_LT(layout.nodeRect(edge.m_from).m_maxX, layout.nodeRect(edge.m_to).m_minX);
+    EXPECT_FALSE(layout.nodeRect(id("left")).intersects(layout.nodeRect(id("right"))));
+}
+
+TEST_F(TechTreeLayoutTest, SharedDescendantsArePlacedOnce)
+{
+    const unsigned depth = 20;
+    research.loadTechnologies(makeDiamondChain(depth));
+    layout.build(research);
+
+    EXPECT_EQ(layout.nodes().size(), 2u * (depth + 1));
+    EXPECT_EQ(layout.layerCount(), depth + 1);
+    EXPECT_EQ(layout.edges().size(), 4u * depth);
+
+    vector<TechId> nodes;
+    vector<unsigned> edges;
+    layout.query(layout.bounds(), nodes, edges);
+    EXPECT_EQ(nodes.size(), layout.nodes().size());
+    EXPECT_EQ(edges.size(), layout.edges().size());
+}
+
+TEST_F(TechTreeLayoutTest, QueryMatchesBruteForce)
+{
+    // losowy DAG: wymagania tylko wśród wcześniejszych węzłów
+    mt19937 rng(7);
+    vector<Technology> techs;
+    for (unsigned i = 0; i < 400; ++i)
+    {
+        vector<Symbol> prerequisites;
+        for (unsigned p = 0; i > 0 && p < rng() % 4; ++p)
+        {
+            const Symbol pre = "t" + to_string(rng() % i);
+            if (find(prerequisites.begin(), prerequisites.end(), pre) == prerequisites.end())
+                prerequisites.push_back(pre);
+        }
+        techs.push_back(makeTech("t" + to_string(i), 5, std::move(prerequisites)));
+    }
+    research.loadTechnologies(techs);
+    layout.build(research);
+
+    const LayoutRect &bounds = layout.bounds();
+    uniform_real_distribution<float> x(bounds.m_minX - 300.f, bounds.m_maxX);
+    uniform_real_distribution<float> y(bounds.m_minY - 300.f, bounds.m_maxY);
+
+    vector<TechId> nodes;
+    vector<unsigned> edges;
+    for (unsigned q = 0; q < 50; ++q)
+    {
+        const float left = x(rng);
+        const float top = y(rng);
+        const LayoutRect area{left, top, left + 900.f, top + 500.f};
+        layout.query(area, nodes, edges);
+
+        vector<TechId> expectedNodes;
+        for (TechId i = 0; i < layout.nodes().size(); ++i)
+        {
+            if (layout.nodeRect(i).intersects(area))
+                expectedNodes.push_back(i);
+        }
+        // krawędź, której krzywa wchodzi w obszar, musi być w wyniku; wynik nie wychodzi
+        // poza krawędzie, których prostokąt przecina obszar
+        vector<unsigned> visibleEdges;
+        vector<unsigned> candidateEdges;
+        for (unsigned i = 0; i < layout.edges().size(); ++i)
+        {
+            const auto &edge = layout.edges()[i];
+            if (layout.edgeRect(edge).intersects(area))
+                candidateEdges.push_back(i);
+            for (unsigned s = 0; s <= 64; ++s)
+            {
+                const LayoutPoint point = layout.edgePoint(edge, static_cast<float>(s) / 64.f);
+                if (area.contains(point.m_x, point.m_y))
+                {
+                    visibleEdges.push_back(i);
+                    break;
+                }
+            }
+        }
+
+        sort(nodes.begin(), nodes.end());
+        sort(edges.begin(), edges.end());
+        ASSERT_EQ(nodes, expectedNodes) << "query " << q;
+        ASSERT_TRUE(adjacent_find(edges.begin(), edges.end()) == edges.end()) << "query " << q;
+        ASSERT_TRUE(includes(edges.begin(), edges.end(), visibleEdges.begin(), visibleEdges.end())) << "query " << q;
+        ASSERT_TRUE(includes(candidateEdges.begin(), candidateEdges.end(), edges.begin(), edges.end())) << "query " << q;
+    }
+}
+
+TEST_F(TechTreeLayoutTest, HitTestFindsNodeUnderPoint)
+{
+    research.loadTechnologies(makeDiamondChain(3));
+    layout.build(research);
+
+    for (TechId i = 0; i < layout.nodes().size(); ++i)
+    {
+        const LayoutRect rect = layout.nodeRect(i);
+        const auto hit = layout.hitTest((rect.m_minX + rect.m_maxX) * 0.5f, (rect.m_minY + rect.m_maxY) * 0.5f);
+        ASSERT_TRUE(hit.has_value());
+        EXPECT_EQ(*hit, i);
+    }
+
+    // przerwa między warstwami i punkt poza drzewem
+    const LayoutRect first = layout.nodeRect(0);
+    EXPECT_FALSE(layout.hitTest(first.m_maxX + TechTreeLayout::LAYER_GAP * 0.5f, first.m_minY + 1.f).has_value());
+    EXPECT_FALSE(layout.hitTest(-50.f, -50.f).has_value());
+}
+
+TEST_F(TechTreeLayoutTest, CyclesGoToSeparateLayer)
+{
+    research.loadTechnologies({
+        makeTech("root", 5, {}),
+        makeTech("a", 5, {"b"}),
+        makeTech("b", 5, {"a"}),
+    });
+    layout.build(research);
+
+    EXPECT_EQ(layout.layerCount(), 2u);
+    EXPECT_EQ(layout.nodes()[id("root")].m_layer, 0u);
+    EXPECT_EQ(layout.nodes()[id("a")].m_layer, 1u);
+    EXPECT_EQ(layout.nodes()[id("b")].m_layer, 1u);
+}
+
+TEST_F(TechTreeLayoutTest, GraphVersionChangesOnLoad)
+{
+    const auto before = research.getGraphVersion();
+    research.loadTechnologies(makeDiamondChain(1));
+    EXPECT_NE(research.getGraphVersion(), before);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Research/ResearchManager.hpp"
+
+// Pola technologii, których większość testów nie ustawia (0 = brak wymagania).
+struct TechOptions
+{
+    unsigned scientists = 0;
+    unsigned moneyCost = 0;
+    unsigned dailyCost = 0;
+};
+
+// Wspólna fabryka technologii testowych: teoria o nazwie równej id.
+inline Technology makeTech(const std::string &id, unsigned short days,
+                           std::vector<Symbol> prerequisites = {}, TechOptions options = {})
+{
+    Technology tech;
+    tech.m_id = id;
+    tech.m_name = id;
+    tech.m_type = TechnologyType::Theory;
+    tech.m_researchDays = days;
+    tech.m_prerequisites = std::move(prerequisites);
+    tech.m_scientistsRequired = options.scientists;
+    tech.m_moneyCost = options.moneyCost;
+    tech.m_daylyCost = options.dailyCost;
+    return tech;
+}